@@ -10,15 +10,20 @@
 #include "get_bytecode.hpp"
 #include "get_grumpkin_crs.hpp"
 #include "log.hpp"
+#include "server.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/common/op_count.hpp>
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/dsl/acir_proofs/goblin_acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <barretenberg/ultra_honk/verification_key_cache.hpp>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -37,6 +42,15 @@ bool verbose = false;
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
+// The number of bn254 G1 points currently held by the global crs_factory. A long-lived process (see `bb server`)
+// only reloads the CRS when a circuit needs more points than are already resident.
+size_t bn254_crs_size = 0;
+bool bn254_crs_initialized = false;
+size_t grumpkin_crs_size = 0;
+// Honk commitment keys over the resident bn254 CRS, by number of points. Each one owns the pippenger scratch space for
+// its size, so they are kept between proofs and only dropped when the CRS is reloaded.
+std::map<size_t, std::shared_ptr<bb::CommitmentKey<curve::BN254>>> bn254_commitment_keys;
+
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
  *
@@ -45,9 +59,44 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    const size_t num_points = dyadic_circuit_size + 1;
+    if (bn254_crs_initialized && num_points <= bn254_crs_size) {
+        return;
+    }
+    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, num_points);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
     srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    bn254_crs_size = num_points;
+    bn254_crs_initialized = true;
+    bn254_commitment_keys.clear();
+}
+
+/**
+ * @brief Get a Honk commitment key for a known dyadic circuit size, reusing the one built by an earlier proof
+ * @details The bn254 CRS must already hold enough points, see `init_bn254_crs`
+ *
+ * @param dyadic_circuit_size power-of-2 circuit size
+ */
+std::shared_ptr<bb::CommitmentKey<curve::BN254>> get_bn254_commitment_key(size_t dyadic_circuit_size)
+{
+    auto& commitment_key = bn254_commitment_keys[dyadic_circuit_size + 1];
+    if (!commitment_key) {
+        commitment_key = std::make_shared<bb::CommitmentKey<curve::BN254>>(dyadic_circuit_size + 1);
+    }
+    return commitment_key;
+}
+
+/**
+ * @brief Initialize the global crs_factory with only the G2 point, unless a CRS is already loaded
+ */
+void init_bn254_verifier_crs()
+{
+    if (bn254_crs_initialized) {
+        return;
+    }
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+    bn254_crs_initialized = true;
 }
 
 /**
@@ -58,8 +107,12 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
+    if (eccvm_dyadic_circuit_size <= grumpkin_crs_size) {
+        return;
+    }
     auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size);
     srs::init_grumpkin_crs_factory(grumpkin_g1_data);
+    grumpkin_crs_size = eccvm_dyadic_circuit_size;
 }
 
 // Initializes without loading G1
@@ -67,8 +120,7 @@ void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 acir_proofs::AcirComposer verifier_init()
 {
     acir_proofs::AcirComposer acir_composer(0, verbose);
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
     return acir_composer;
 }
 
@@ -270,7 +322,7 @@ bool proveAndVerifyGoblin(const std::string& bytecodePath, const std::string& wi
  * @param recursive Whether to use recursive proof generation of non-recursive
  * @param outputPath Path to write the proof to
  */
-void prove(const std::string& bytecodePath, const std::string& witnessPath, const std::string& outputPath)
+std::vector<uint8_t> compute_proof(const std::string& bytecodePath, const std::string& witnessPath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     auto witness = get_witness(witnessPath);
@@ -279,7 +331,12 @@ void prove(const std::string& bytecodePath, const std::string& witnessPath, cons
     acir_composer.create_circuit(constraint_system, witness);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     acir_composer.init_proving_key();
-    auto proof = acir_composer.create_proof();
+    return acir_composer.create_proof();
+}
+
+void prove(const std::string& bytecodePath, const std::string& witnessPath, const std::string& outputPath)
+{
+    auto proof = compute_proof(bytecodePath, witnessPath);
 
     if (outputPath == "-") {
         writeRawBytesToStdout(proof);
@@ -348,17 +405,22 @@ void gateCount(const std::string& bytecodePath)
  * @return true If the proof is valid
  * @return false If the proof is invalid
  */
-bool verify(const std::string& proof_path, const std::string& vk_path)
+bool verify_buffers(std::vector<uint8_t> const& proof, std::vector<uint8_t> const& vk)
 {
     auto acir_composer = verifier_init();
-    auto vk_data = from_buffer<plonk::verification_key_data>(read_file(vk_path));
+    auto vk_data = from_buffer<plonk::verification_key_data>(vk);
     acir_composer.load_verification_key(std::move(vk_data));
-    auto verified = acir_composer.verify_proof(read_file(proof_path));
+    auto verified = acir_composer.verify_proof(proof);
 
     vinfo("verified: ", verified);
     return verified;
 }
 
+bool verify(const std::string& proof_path, const std::string& vk_path)
+{
+    return verify_buffers(read_file(proof_path), read_file(vk_path));
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -369,7 +431,7 @@ bool verify(const std::string& proof_path, const std::string& vk_path)
  * @param bytecodePath Path to the file containing the serialized circuit
  * @param outputPath Path to write the verification key to
  */
-void write_vk(const std::string& bytecodePath, const std::string& outputPath)
+std::vector<uint8_t> compute_vk(const std::string& bytecodePath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
@@ -377,7 +439,12 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     acir_composer.init_proving_key();
     auto vk = acir_composer.init_verification_key();
-    auto serialized_vk = to_buffer(*vk);
+    return to_buffer(*vk);
+}
+
+void write_vk(const std::string& bytecodePath, const std::string& outputPath)
+{
+    auto serialized_vk = compute_vk(bytecodePath);
     if (outputPath == "-") {
         writeRawBytesToStdout(serialized_vk);
         vinfo("vk written to stdout");
@@ -578,9 +645,10 @@ bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::
  * @param outputPath Path to write the proof to
  */
 template <IsUltraFlavor Flavor>
-void prove_honk(const std::string& bytecodePath, const std::string& witnessPath, const std::string& outputPath)
+std::vector<uint8_t> compute_honk_proof(const std::string& bytecodePath, const std::string& witnessPath)
 {
     using Builder = Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
     using Prover = UltraProver_<Flavor>;
 
     auto constraint_system = get_constraint_system(bytecodePath);
@@ -593,14 +661,23 @@ void prove_honk(const std::string& bytecodePath, const std::string& witnessPath,
     init_bn254_crs(srs_size);
 
     // Construct Honk proof
-    Prover prover{ builder };
+    auto instance =
+        std::make_shared<ProverInstance>(builder, /*is_structured=*/false, get_bn254_commitment_key(srs_size));
+    Prover prover{ instance };
     auto proof = prover.construct_proof();
+    return to_buffer</*include_size=*/true>(proof);
+}
+
+template <IsUltraFlavor Flavor>
+void prove_honk(const std::string& bytecodePath, const std::string& witnessPath, const std::string& outputPath)
+{
+    auto proof = compute_honk_proof<Flavor>(bytecodePath, witnessPath);
 
     if (outputPath == "-") {
-        writeRawBytesToStdout(to_buffer</*include_size=*/true>(proof));
+        writeRawBytesToStdout(proof);
         vinfo("proof written to stdout");
     } else {
-        write_file(outputPath, to_buffer</*include_size=*/true>(proof));
+        write_file(outputPath, proof);
         vinfo("proof written to: ", outputPath);
     }
 }
@@ -620,16 +697,16 @@ void prove_honk(const std::string& bytecodePath, const std::string& witnessPath,
  * @return true If the proof is valid
  * @return false If the proof is invalid
  */
-template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path, const std::string& vk_path)
+template <IsUltraFlavor Flavor>
+bool verify_honk_buffers(std::vector<uint8_t> const& proof_buffer, std::vector<uint8_t> const& vk_buffer)
 {
     using VerificationKey = Flavor::VerificationKey;
     using Verifier = UltraVerifier_<Flavor>;
     using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
 
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
-    auto proof = from_buffer<std::vector<bb::fr>>(read_file(proof_path));
-    auto verification_key = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+    init_bn254_verifier_crs();
+    auto proof = from_buffer<std::vector<bb::fr>>(proof_buffer);
+    auto verification_key = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buffer));
     verification_key->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
 
     Verifier verifier{ verification_key };
@@ -640,6 +717,11 @@ template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path,
     return verified;
 }
 
+template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path, const std::string& vk_path)
+{
+    return verify_honk_buffers<Flavor>(read_file(proof_path), read_file(vk_path));
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -650,11 +732,10 @@ template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path,
  * @param bytecodePath Path to the file containing the serialized circuit
  * @param outputPath Path to write the verification key to
  */
-template <IsUltraFlavor Flavor> void write_vk_honk(const std::string& bytecodePath, const std::string& outputPath)
+template <IsUltraFlavor Flavor> std::vector<uint8_t> compute_honk_vk(const std::string& bytecodePath)
 {
     using Builder = Flavor::CircuitBuilder;
     using ProverInstance = ProverInstance_<Flavor>;
-    using VerificationKey = Flavor::VerificationKey;
 
     auto constraint_system = get_constraint_system(bytecodePath);
     auto builder = acir_format::create_circuit<Builder>(constraint_system, 0, {});
@@ -663,11 +744,18 @@ template <IsUltraFlavor Flavor> void write_vk_honk(const std::string& bytecodePa
     size_t srs_size = builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + num_extra_gates);
     init_bn254_crs(srs_size);
 
-    ProverInstance prover_inst(builder);
-    VerificationKey vk(
-        prover_inst.proving_key); // uses a partial form of the proving key which only has precomputed entities
+    ProverInstance prover_inst(builder, /*is_structured=*/false, get_bn254_commitment_key(srs_size));
+    // uses a partial form of the proving key which only has precomputed entities
+    auto vk = compute_verification_key<Flavor>(prover_inst.proving_key);
+    if (auto cache = get_verification_key_cache()) {
+        vinfo("vk cache: ", cache->get_num_hits(), " hits, ", cache->get_num_misses(), " misses");
+    }
+    return to_buffer(*vk);
+}
 
-    auto serialized_vk = to_buffer(vk);
+template <IsUltraFlavor Flavor> void write_vk_honk(const std::string& bytecodePath, const std::string& outputPath)
+{
+    auto serialized_vk = compute_honk_vk<Flavor>(bytecodePath);
     if (outputPath == "-") {
         writeRawBytesToStdout(serialized_vk);
         vinfo("vk written to stdout");
@@ -784,6 +872,66 @@ void prove_output_all(const std::string& bytecodePath, const std::string& witnes
     vinfo("vk as fields written to: ", vkFieldsOutputPath);
 }
 
+/**
+ * @brief Serve a single request of `bb server`
+ *
+ * @details Requests reuse everything the one-shot commands cache in process-wide state: the CRS (see
+ * `init_bn254_crs`), the plookup multitables and the Honk commitment keys (see `get_bn254_commitment_key`).
+ */
+server::Response handle_server_request(server::Request const& request)
+{
+    server::Response response;
+    auto const& command = request.command;
+    if (command == "prove") {
+        response.data = compute_proof(request.bytecode_path, request.witness_path);
+        response.success = true;
+    } else if (command == "verify") {
+        response.success = verify_buffers(request.proof, request.vk);
+    } else if (command == "write_vk") {
+        response.data = compute_vk(request.bytecode_path);
+        response.success = true;
+    } else if (command == "prove_ultra_honk") {
+        response.data = compute_honk_proof<UltraFlavor>(request.bytecode_path, request.witness_path);
+        response.success = true;
+    } else if (command == "verify_ultra_honk") {
+        response.success = verify_honk_buffers<UltraFlavor>(request.proof, request.vk);
+    } else if (command == "write_vk_ultra_honk") {
+        response.data = compute_honk_vk<UltraFlavor>(request.bytecode_path);
+        response.success = true;
+    } else if (command == "prove_mega_honk") {
+        response.data = compute_honk_proof<MegaFlavor>(request.bytecode_path, request.witness_path);
+        response.success = true;
+    } else if (command == "verify_mega_honk") {
+        response.success = verify_honk_buffers<MegaFlavor>(request.proof, request.vk);
+    } else if (command == "write_vk_mega_honk") {
+        response.data = compute_honk_vk<MegaFlavor>(request.bytecode_path);
+        response.success = true;
+    } else {
+        response.error = "Unknown command: " + command;
+    }
+    return response;
+}
+
+/**
+ * @brief Run `bb` as a persistent prover, see server.hpp for the protocol
+ *
+ * Communication:
+ * - stdin/stdout: length-prefixed msgpack requests and responses, unless a socket path is given
+ * - Unix socket: the same protocol on every accepted connection
+ *
+ * @param socket_path Path of the Unix socket to listen on, or empty to serve stdin/stdout
+ */
+void run_server(const std::string& socket_path)
+{
+    if (socket_path.empty()) {
+        vinfo("serving requests on stdin");
+        server::serve(STDIN_FILENO, STDOUT_FILENO, handle_server_request);
+    } else {
+        vinfo("serving requests on ", socket_path);
+        server::serve_unix_socket(socket_path, handle_server_request);
+    }
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -795,11 +943,53 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Records the BB_OP_COUNT_TIME spans of all threads while alive and writes them as a Chrome trace (viewable in
+ * chrome://tracing or Perfetto) on destruction
+ * @details Only op-count builds (-DBB_USE_OP_COUNT, e.g. the op-count-time preset) record spans.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct TraceOutput {
+    std::string path;
+
+    TraceOutput(std::string path)
+        : path(std::move(path))
+    {
+        if (this->path.empty()) {
+            return;
+        }
+#ifdef BB_USE_OP_COUNT
+        bb::detail::GLOBAL_TRACE.clear();
+        bb::detail::GLOBAL_TRACE.enabled = true;
+#else
+        info("warning: bb was built without BB_USE_OP_COUNT, no trace will be written to ", this->path);
+#endif
+    }
+
+    ~TraceOutput()
+    {
+#ifdef BB_USE_OP_COUNT
+        if (path.empty()) {
+            return;
+        }
+        bb::detail::GLOBAL_TRACE.enabled = false;
+        std::ofstream file(path);
+        bb::detail::GLOBAL_TRACE.write_chrome_trace(file);
+        vinfo("wrote trace to ", path);
+#endif
+    }
+};
+
 int main(int argc, char* argv[])
 {
     try {
         std::vector<std::string> args(argv + 1, argv + argc);
         verbose = flag_present(args, "-v") || flag_present(args, "--verbose");
+        TraceOutput trace_output(get_option(args, "--trace-out", ""));
+        std::string vk_cache_path = get_option(args, "--vk-cache", "");
+        if (!vk_cache_path.empty()) {
+            init_verification_key_cache(vk_cache_path);
+        }
 
         if (args.empty()) {
             std::cerr << "No command provided.\n";
@@ -836,7 +1026,9 @@ int main(int argc, char* argv[])
             return proveAndVerifyGoblin(bytecode_path, witness_path) ? 0 : 1;
         }
 
-        if (command == "prove") {
+        if (command == "server") {
+            run_server(get_option(args, "-s", ""));
+        } else if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
             prove(bytecode_path, witness_path, output_path);
         } else if (command == "prove_output_all") {
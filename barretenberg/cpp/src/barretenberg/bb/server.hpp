@@ -0,0 +1,194 @@
+#pragma once
+#include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * @brief A persistent `bb` process that serves prove/verify/write_vk requests
+ *
+ * @details Every one-shot `bb` invocation pays for loading the CRS, building the plookup multitables and setting up
+ * commitment keys before it does any useful work. In server mode these live for the whole lifetime of the process.
+ *
+ * The wire format is a sequence of frames, each being a 4 byte little-endian length followed by that many bytes of a
+ * msgpack-encoded `Request` (client to server) or `Response` (server to client). Requests are served one at a time, in
+ * order; a client may pipeline several requests before reading the responses.
+ */
+namespace bb::server {
+
+struct Request {
+    // Any of the `bb` command names supported by the server, e.g. "prove" or "verify_ultra_honk"
+    std::string command;
+    // Inputs for commands that build a circuit; same format as the `-b` and `-w` CLI options
+    std::string bytecode_path;
+    std::string witness_path;
+    // Inputs for verification commands, as they would be read from the `-p` and `-k` files
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    MSGPACK_FIELDS(command, bytecode_path, witness_path, proof, vk);
+};
+
+struct Response {
+    bool success = false;
+    std::string error;
+    // The proof or verification key, as it would be written to the `-o` file
+    std::vector<uint8_t> data;
+    MSGPACK_FIELDS(success, error, data);
+};
+
+using Handler = std::function<Response(Request const&)>;
+
+inline bool read_exact(int fd, uint8_t* buffer, size_t size)
+{
+    while (size > 0) {
+        ssize_t count = ::read(fd, buffer, size);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        buffer += count;
+        size -= static_cast<size_t>(count);
+    }
+    return true;
+}
+
+inline bool write_exact(int fd, const uint8_t* buffer, size_t size)
+{
+    while (size > 0) {
+        ssize_t count = ::write(fd, buffer, size);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        buffer += count;
+        size -= static_cast<size_t>(count);
+    }
+    return true;
+}
+
+/**
+ * @brief Read one length-prefixed frame. Returns false on a clean or unclean end of stream.
+ * @details The frame grows as its bytes arrive rather than being sized from the prefix up front, so a corrupt length
+ * followed by a short stream does not allocate up to 4GB.
+ */
+inline bool read_frame(int fd, std::vector<uint8_t>& frame)
+{
+    constexpr size_t MAX_CHUNK_SIZE = 1 << 20;
+    uint8_t prefix[4];
+    if (!read_exact(fd, prefix, sizeof(prefix))) {
+        return false;
+    }
+    uint32_t size = 0;
+    for (size_t i = 0; i < sizeof(prefix); ++i) {
+        size |= static_cast<uint32_t>(prefix[i]) << (8 * i);
+    }
+    frame.clear();
+    while (frame.size() < size) {
+        const size_t offset = frame.size();
+        frame.resize(offset + std::min<size_t>(size - offset, MAX_CHUNK_SIZE));
+        if (!read_exact(fd, frame.data() + offset, frame.size() - offset)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool write_frame(int fd, const char* data, size_t size)
+{
+    if (size > UINT32_MAX) {
+        throw std::runtime_error("Response too large for a single frame.");
+    }
+    uint8_t prefix[4];
+    for (size_t i = 0; i < sizeof(prefix); ++i) {
+        prefix[i] = static_cast<uint8_t>(size >> (8 * i));
+    }
+    return write_exact(fd, prefix, sizeof(prefix)) && write_exact(fd, reinterpret_cast<const uint8_t*>(data), size);
+}
+
+/**
+ * @brief Serve requests read from `in_fd` until the stream ends or a "shutdown" request arrives.
+ * @return true if a "shutdown" request was received.
+ */
+inline bool serve(int in_fd, int out_fd, Handler const& handler)
+{
+    std::vector<uint8_t> frame;
+    while (read_frame(in_fd, frame)) {
+        Request request;
+        Response response;
+        try {
+            msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size()).get().convert(request);
+            if (request.command == "shutdown") {
+                response.success = true;
+            } else {
+                response = handler(request);
+            }
+        } catch (std::exception const& err) {
+            response.success = false;
+            response.error = err.what();
+        }
+
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, response);
+        if (!write_frame(out_fd, buffer.data(), buffer.size())) {
+            return false;
+        }
+        if (request.command == "shutdown") {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Listen on a Unix domain socket at `socket_path` and serve connections one after another, until a client
+ * sends a "shutdown" request.
+ */
+inline void serve_unix_socket(std::string const& socket_path, Handler const& handler)
+{
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Socket path too long: " + socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw std::runtime_error("Failed to create socket.");
+    }
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listen_fd, 16) != 0) {
+        close(listen_fd);
+        throw std::runtime_error("Failed to listen on socket: " + socket_path);
+    }
+
+    bool shutdown = false;
+    while (!shutdown) {
+        int connection_fd = accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        shutdown = serve(connection_fd, connection_fd, handler);
+        close(connection_fd);
+    }
+
+    close(listen_fd);
+    unlink(socket_path.c_str());
+}
+
+} // namespace bb::server
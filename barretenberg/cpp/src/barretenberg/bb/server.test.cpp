@@ -0,0 +1,193 @@
+#include "server.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb::server;
+
+namespace {
+
+// Both ends of a pipe, closed on destruction. Tests only write a few KB, which fits in the pipe buffer.
+struct Pipe {
+    int read_fd = -1;
+    int write_fd = -1;
+
+    Pipe()
+    {
+        int fds[2];
+        EXPECT_EQ(pipe(fds), 0);
+        read_fd = fds[0];
+        write_fd = fds[1];
+    }
+    ~Pipe()
+    {
+        close_read();
+        close_write();
+    }
+    void close_read()
+    {
+        if (read_fd >= 0) {
+            close(read_fd);
+            read_fd = -1;
+        }
+    }
+    void close_write()
+    {
+        if (write_fd >= 0) {
+            close(write_fd);
+            write_fd = -1;
+        }
+    }
+};
+
+Request make_request(std::string command)
+{
+    Request request;
+    request.command = std::move(command);
+    return request;
+}
+
+void write_request(int fd, Request const& request)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, request);
+    EXPECT_TRUE(write_frame(fd, buffer.data(), buffer.size()));
+}
+
+Response read_response(int fd)
+{
+    std::vector<uint8_t> frame;
+    EXPECT_TRUE(read_frame(fd, frame));
+    Response response;
+    msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size()).get().convert(response);
+    return response;
+}
+
+Response echo_handler(Request const& request)
+{
+    if (request.command == "fail") {
+        throw std::runtime_error("handler failed");
+    }
+    Response response;
+    response.success = true;
+    response.data = std::vector<uint8_t>(request.command.begin(), request.command.end());
+    return response;
+}
+
+} // namespace
+
+TEST(BbServer, FrameRoundTrip)
+{
+    Pipe pipe;
+    const std::vector<std::string> frames{ "", "a", std::string(300, 'x'), std::string(4000, 'y') };
+    for (auto const& frame : frames) {
+        EXPECT_TRUE(write_frame(pipe.write_fd, frame.data(), frame.size()));
+    }
+    pipe.close_write();
+
+    std::vector<uint8_t> frame;
+    for (auto const& expected : frames) {
+        EXPECT_TRUE(read_frame(pipe.read_fd, frame));
+        EXPECT_EQ(std::string(frame.begin(), frame.end()), expected);
+    }
+    // Clean end of stream
+    EXPECT_FALSE(read_frame(pipe.read_fd, frame));
+}
+
+TEST(BbServer, TruncatedFrames)
+{
+    std::vector<uint8_t> frame;
+    {
+        // Stream ends inside the length prefix
+        Pipe pipe;
+        const uint8_t prefix[2] = { 5, 0 };
+        EXPECT_TRUE(write_exact(pipe.write_fd, prefix, sizeof(prefix)));
+        pipe.close_write();
+        EXPECT_FALSE(read_frame(pipe.read_fd, frame));
+    }
+    {
+        // Stream ends inside the body
+        Pipe pipe;
+        const uint8_t data[7] = { 100, 0, 0, 0, 1, 2, 3 };
+        EXPECT_TRUE(write_exact(pipe.write_fd, data, sizeof(data)));
+        pipe.close_write();
+        EXPECT_FALSE(read_frame(pipe.read_fd, frame));
+    }
+    {
+        // A corrupt length prefix claiming the maximal frame size
+        Pipe pipe;
+        const uint8_t data[8] = { 0xff, 0xff, 0xff, 0xff, 1, 2, 3, 4 };
+        EXPECT_TRUE(write_exact(pipe.write_fd, data, sizeof(data)));
+        pipe.close_write();
+        EXPECT_FALSE(read_frame(pipe.read_fd, frame));
+        EXPECT_LT(frame.capacity(), size_t(1) << 24);
+    }
+}
+
+TEST(BbServer, ServeAnswersRequestsInOrder)
+{
+    Pipe requests;
+    Pipe responses;
+    write_request(requests.write_fd, make_request("first"));
+    write_request(requests.write_fd, make_request("second"));
+    write_request(requests.write_fd, make_request("shutdown"));
+    // Never served, the server stops at the shutdown request
+    write_request(requests.write_fd, make_request("third"));
+    requests.close_write();
+
+    EXPECT_TRUE(serve(requests.read_fd, responses.write_fd, echo_handler));
+    responses.close_write();
+
+    for (std::string command : { "first", "second" }) {
+        auto response = read_response(responses.read_fd);
+        EXPECT_TRUE(response.success);
+        EXPECT_EQ(std::string(response.data.begin(), response.data.end()), command);
+    }
+    auto response = read_response(responses.read_fd);
+    EXPECT_TRUE(response.success);
+    EXPECT_TRUE(response.data.empty());
+
+    std::vector<uint8_t> frame;
+    EXPECT_FALSE(read_frame(responses.read_fd, frame));
+}
+
+TEST(BbServer, ServeReportsMalformedRequests)
+{
+    Pipe requests;
+    Pipe responses;
+    // Not msgpack at all (0xc1 is never used by the format)
+    const std::vector<char> garbage{ static_cast<char>(0xc1), 1, 2 };
+    EXPECT_TRUE(write_frame(requests.write_fd, garbage.data(), garbage.size()));
+    // Valid msgpack that is not a Request
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, 42);
+    EXPECT_TRUE(write_frame(requests.write_fd, buffer.data(), buffer.size()));
+    // The handler throws
+    write_request(requests.write_fd, make_request("fail"));
+    // The server is still serving after the failures
+    write_request(requests.write_fd, make_request("ok"));
+    // Finally a truncated frame
+    const uint8_t truncated[6] = { 10, 0, 0, 0, 1, 2 };
+    EXPECT_TRUE(write_exact(requests.write_fd, truncated, sizeof(truncated)));
+    requests.close_write();
+
+    // The stream ends without a shutdown request
+    EXPECT_FALSE(serve(requests.read_fd, responses.write_fd, echo_handler));
+    responses.close_write();
+
+    for (size_t i = 0; i < 2; ++i) {
+        auto response = read_response(responses.read_fd);
+        EXPECT_FALSE(response.success);
+        EXPECT_FALSE(response.error.empty());
+    }
+    auto response = read_response(responses.read_fd);
+    EXPECT_FALSE(response.success);
+    EXPECT_EQ(response.error, "handler failed");
+
+    response = read_response(responses.read_fd);
+    EXPECT_TRUE(response.success);
+    EXPECT_EQ(std::string(response.data.begin(), response.data.end()), "ok");
+
+    std::vector<uint8_t> frame;
+    EXPECT_FALSE(read_frame(responses.read_fd, frame));
+}
@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
+#include <memory>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
@@ -12,6 +13,10 @@ using Poseidon2 = AppendOnlyTree<ArrayStore, Poseidon2HashPolicy>;
 
 const size_t TREE_DEPTH = 32;
 const size_t MAX_BATCH_SIZE = 128;
+const size_t MIN_THROUGHPUT_BATCH_SIZE = 64;
+const size_t MAX_THROUGHPUT_BATCH_SIZE = 64 * 1024;
+// Number of leaves the store of the throughput benchmark has room for, before the tree is recreated
+const size_t STORE_CAPACITY = 1024 * 1024;
 
 namespace {
 auto& random_engine = bb::numeric::get_randomness();
@@ -51,4 +56,40 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
-BENCHMARK_MAIN();
\ No newline at end of file
+/**
+ * @brief Measures the insertion throughput (reported as items_per_second, i.e. leaves/sec) of large batches
+ */
+template <typename TreeType> void append_only_tree_throughput_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    auto store = std::make_unique<ArrayStore>(depth, STORE_CAPACITY);
+    auto tree = std::make_unique<TreeType>(*store, depth);
+
+    std::vector<fr> values(batch_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (size_t(tree->size()) + batch_size > STORE_CAPACITY) {
+            tree.reset();
+            store = std::make_unique<ArrayStore>(depth, STORE_CAPACITY);
+            tree = std::make_unique<TreeType>(*store, depth);
+        }
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        perform_batch_insert(*tree, values);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(batch_size));
+}
+BENCHMARK(append_only_tree_throughput_bench<Pedersen>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(MIN_THROUGHPUT_BATCH_SIZE, MAX_THROUGHPUT_BATCH_SIZE);
+BENCHMARK(append_only_tree_throughput_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(MIN_THROUGHPUT_BATCH_SIZE, MAX_THROUGHPUT_BATCH_SIZE);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief Add 2^n variables and assert each new one equal to a single class that grows to hold all of them
+ * @details The growing class is the second argument of assert_equal, whose members used to be relabelled one by one.
+ */
+void assert_equal_growing_class(State& state)
+{
+    const size_t num_variables = 1UL << static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        UltraCircuitBuilder builder;
+        const fr value = fr::random_element();
+        const uint32_t first_variable = builder.add_variable(value);
+        for (size_t i = 1; i < num_variables; ++i) {
+            builder.assert_equal(builder.add_variable(value), first_variable);
+        }
+        DoNotOptimize(builder.get_first_variable_in_class(first_variable));
+    }
+}
+
+/**
+ * @brief Add 2^n variables and assert 2^n random pairs of them equal
+ */
+void assert_equal_random_pairs(State& state)
+{
+    const size_t num_variables = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<std::pair<uint32_t, uint32_t>> pairs(num_variables);
+    for (auto& [a, b] : pairs) {
+        a = engine.get_random_uint32() % static_cast<uint32_t>(num_variables);
+        b = engine.get_random_uint32() % static_cast<uint32_t>(num_variables);
+    }
+    for (auto _ : state) {
+        UltraCircuitBuilder builder;
+        const fr value = fr::random_element();
+        const uint32_t offset = builder.add_variable(value);
+        for (size_t i = 1; i < num_variables; ++i) {
+            builder.add_variable(value);
+        }
+        for (const auto& [a, b] : pairs) {
+            builder.assert_equal(offset + a, offset + b);
+        }
+        DoNotOptimize(builder.variable_classes[offset]);
+    }
+}
+} // namespace
+
+BENCHMARK(assert_equal_growing_class)->Unit(kMillisecond)->DenseRange(16, 22, 2);
+BENCHMARK(assert_equal_random_pairs)->Unit(kMillisecond)->DenseRange(16, 22, 2);
+
+BENCHMARK_MAIN();
@@ -24,6 +24,9 @@ class ClientIVCBench : public benchmark::Fixture {
     // Number of function circuits to accumulate(based on Zacs target numbers)
     static constexpr size_t NUM_ITERATIONS_MEDIUM_COMPLEXITY = 6;
 
+    // Number of function circuits accumulated with a stack of 10 kernels
+    static constexpr size_t NUM_FUNCTION_CIRCUITS_TEN_KERNELS = 11;
+
     void SetUp([[maybe_unused]] const ::benchmark::State& state) override
     {
         bb::srs::init_crs_factory("../srs_db/ignition");
@@ -142,6 +145,42 @@ class ClientIVCBench : public benchmark::Fixture {
         }
         ivc.accumulate(kernel_circuit, precomputed_vks.back());
     }
+
+    /**
+     * @brief Perform the same accumulation rounds as perform_ivc_accumulation_rounds with
+     * ClientIVC::accumulate_pipelined, which constructs each circuit while the previous one is being folded
+     *
+     * @param NUM_CIRCUITS Number of function circuits to accumulate
+     */
+    static void perform_pipelined_ivc_accumulation_rounds(size_t NUM_CIRCUITS, ClientIVC& ivc, auto& precomputed_vks)
+    {
+        size_t TOTAL_NUM_CIRCUITS = NUM_CIRCUITS * 2 - 1;     // need one less kernel than number of function circuits
+        ASSERT(precomputed_vks.size() == TOTAL_NUM_CIRCUITS); // ensure presence of a precomputed VK for each circuit
+
+        const size_t size_hint = 1 << 17; // Size hint for reserving wires/selector vector memory in builders
+        const auto construct_function_circuit = [] {
+            Builder circuit;
+            GoblinMockCircuits::construct_mock_function_circuit(circuit);
+            return circuit;
+        };
+        const auto construct_kernel_circuit = [size_hint] {
+            Builder circuit{ size_hint };
+            GoblinMockCircuits::construct_mock_folding_kernel(circuit);
+            return circuit;
+        };
+
+        // Two function circuits followed by pairs of {kernel, function} and a final kernel
+        std::vector<ClientIVC::PipelinedCircuit> circuits;
+        circuits.push_back({ construct_function_circuit, precomputed_vks[0] });
+        circuits.push_back({ construct_function_circuit, precomputed_vks[1] });
+        for (size_t circuit_idx = 2; circuit_idx < TOTAL_NUM_CIRCUITS - 1; circuit_idx += 2) {
+            circuits.push_back({ construct_kernel_circuit, precomputed_vks[circuit_idx] });
+            circuits.push_back({ construct_function_circuit, precomputed_vks[circuit_idx + 1] });
+        }
+        circuits.push_back({ construct_kernel_circuit, precomputed_vks.back() });
+
+        ivc.accumulate_pipelined(circuits);
+    }
 };
 
 /**
@@ -205,6 +244,24 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Accumulate)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark only the accumulation rounds, constructing each circuit while the previous one is being folded
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulatePipelined)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits);
+
+    // Perform a specified number of iterations of function/kernel accumulation
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_pipelined_ivc_accumulation_rounds(num_circuits, ivc, precomputed_vks);
+    }
+}
+
 /**
  * @brief Benchmark only the Decider component
  *
@@ -282,7 +339,12 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, FullStructured)->Unit(benchmark::kMillisecond)->ARGS;
-BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)
+    ->Unit(benchmark::kMillisecond)
+    ->ARGS->Arg(ClientIVCBench::NUM_FUNCTION_CIRCUITS_TEN_KERNELS);
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulatePipelined)
+    ->Unit(benchmark::kMillisecond)
+    ->ARGS->Arg(ClientIVCBench::NUM_FUNCTION_CIRCUITS_TEN_KERNELS);
 BENCHMARK_REGISTER_F(ClientIVCBench, Decide)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, ECCVM)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Translator)->Unit(benchmark::kMillisecond)->ARGS;
@@ -53,6 +53,23 @@ void eccvm_generate_prover(State& state) noexcept
     };
 }
 
+/**
+ * @brief Construct the MSM columns of the ECCVM execution trace, i.e. the rows and read counts that
+ * ECCVMMSMMBuilder::compute_rows derives from the queued MSMs, without building the rest of the prover
+ */
+void eccvm_msm_trace(State& state) noexcept
+{
+    size_t target_num_gates = 1 << static_cast<size_t>(state.range(0));
+    Builder builder = generate_trace(target_num_gates);
+    const auto msms = builder.get_msms();
+    const auto num_muls = builder.get_number_of_muls();
+    const auto num_msm_rows = builder.op_queue->get_num_msm_rows();
+    for (auto _ : state) {
+        auto rows = ECCVMMSMMBuilder::compute_rows(msms, num_muls, num_msm_rows);
+        DoNotOptimize(rows);
+    };
+}
+
 void eccvm_prove(State& state) noexcept
 {
     bb::srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
@@ -66,6 +83,7 @@ void eccvm_prove(State& state) noexcept
 }
 
 BENCHMARK(eccvm_generate_prover)->Unit(kMillisecond)->DenseRange(10, 20);
+BENCHMARK(eccvm_msm_trace)->Unit(kMillisecond)->DenseRange(10, 20);
 BENCHMARK(eccvm_prove)->Unit(kMillisecond)->DenseRange(10, 20);
 } // namespace
 
@@ -1,4 +1,7 @@
 #include "barretenberg/crypto/merkle_tree/merkle_tree.hpp"
+#include "barretenberg/crypto/merkle_tree/append_only_tree/append_only_tree.hpp"
+#include "barretenberg/crypto/merkle_tree/array_store.hpp"
+#include "barretenberg/crypto/merkle_tree/dense_node_store.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/crypto/merkle_tree/memory_store.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -73,4 +76,64 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+// Compares the node stores of the append-only tree: a byte vector per node (ArrayStore) against contiguous 32-byte
+// slots per level (DenseNodeStore)
+constexpr size_t STORE_BENCH_DEPTH = 32;
+constexpr size_t STORE_BENCH_LEAVES = 1 << 16;
+
+template <typename Store> void append_only_tree_hash_paths(State& state) noexcept
+{
+    Store store(STORE_BENCH_DEPTH, STORE_BENCH_LEAVES);
+    AppendOnlyTree<Store, Poseidon2HashPolicy> tree(store, STORE_BENCH_DEPTH);
+    std::vector<fr> values(STORE_BENCH_LEAVES);
+    for (size_t i = 0; i < STORE_BENCH_LEAVES; ++i) {
+        values[i] = fr(i);
+    }
+    tree.add_values(values);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        DoNotOptimize(tree.get_hash_path(index));
+        index = (index + 7919) % STORE_BENCH_LEAVES;
+    }
+}
+BENCHMARK(append_only_tree_hash_paths<ArrayStore>);
+BENCHMARK(append_only_tree_hash_paths<DenseNodeStore>);
+
+void append_only_tree_hash_path_views(State& state) noexcept
+{
+    DenseNodeStore store(STORE_BENCH_DEPTH, STORE_BENCH_LEAVES);
+    AppendOnlyTree<DenseNodeStore, Poseidon2HashPolicy> tree(store, STORE_BENCH_DEPTH);
+    std::vector<fr> values(STORE_BENCH_LEAVES);
+    for (size_t i = 0; i < STORE_BENCH_LEAVES; ++i) {
+        values[i] = fr(i);
+    }
+    tree.add_values(values);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        DoNotOptimize(tree.get_hash_path_view(index));
+        index = (index + 7919) % STORE_BENCH_LEAVES;
+    }
+}
+BENCHMARK(append_only_tree_hash_path_views);
+
+template <typename Store> void append_only_tree_add_values(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    std::vector<fr> values(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        values[i] = fr(i);
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        Store store(STORE_BENCH_DEPTH, batch_size);
+        AppendOnlyTree<Store, Poseidon2HashPolicy> tree(store, STORE_BENCH_DEPTH);
+        state.ResumeTiming();
+        tree.add_values(values);
+    }
+}
+BENCHMARK(append_only_tree_add_values<ArrayStore>)->Unit(benchmark::kMillisecond)->Arg(1024)->Arg(16384);
+BENCHMARK(append_only_tree_add_values<DenseNodeStore>)->Unit(benchmark::kMillisecond)->Arg(1024)->Arg(16384);
+
 BENCHMARK_MAIN();
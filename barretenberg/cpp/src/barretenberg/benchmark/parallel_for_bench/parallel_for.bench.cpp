@@ -0,0 +1,125 @@
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+/**
+ * @brief Compares the parallel_for backends (see common/thread.cpp) on pippenger and sumcheck, plus a nested workload
+ * (several MSMs computed from within a parallel_for) that only the work-stealing backend can parallelise.
+ */
+namespace {
+using Curve = curve::BN254;
+using Fr = Curve::ScalarField;
+using AffineElement = Curve::AffineElement;
+
+constexpr size_t MAX_LOG_NUM_POINTS = 18;
+constexpr size_t NUM_NESTED_MSMS = 4;
+
+constexpr std::array<ParallelForBackend, 4> BACKENDS{ ParallelForBackend::WORK_STEALING,
+                                                      ParallelForBackend::MUTEX_POOL,
+                                                      ParallelForBackend::ATOMIC_POOL,
+                                                      ParallelForBackend::SPAWNING };
+
+struct MsmInputs {
+    std::shared_ptr<AffineElement[]> points;
+    std::vector<Fr> scalars;
+};
+
+const MsmInputs& get_msm_inputs()
+{
+    static const MsmInputs inputs = [] {
+        constexpr size_t num_points = 1 << MAX_LOG_NUM_POINTS;
+        MsmInputs inputs{ scalar_multiplication::point_table_alloc<AffineElement>(num_points),
+                          std::vector<Fr>(num_points) };
+        // Random points are expensive to generate, so use multiples of a random point instead
+        const AffineElement base = AffineElement(Curve::Element::random_element());
+        Curve::Element accumulator = base;
+        for (size_t i = 0; i < num_points; ++i) {
+            inputs.points[i] = accumulator;
+            accumulator += base;
+            inputs.scalars[i] = Fr::random_element();
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            inputs.points.get(), inputs.points.get(), num_points);
+        return inputs;
+    }();
+    return inputs;
+}
+
+void pippenger(State& state)
+{
+    set_parallel_for_backend(BACKENDS[static_cast<size_t>(state.range(0))]);
+    const size_t num_points = 1UL << state.range(1);
+    const auto& inputs = get_msm_inputs();
+    scalar_multiplication::pippenger_runtime_state<Curve> runtime_state(num_points);
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_unsafe<Curve>(
+            const_cast<Fr*>(inputs.scalars.data()), inputs.points.get(), num_points, runtime_state));
+    }
+    set_parallel_for_backend(ParallelForBackend::WORK_STEALING);
+}
+
+void nested_pippenger(State& state)
+{
+    set_parallel_for_backend(BACKENDS[static_cast<size_t>(state.range(0))]);
+    const size_t num_points = 1UL << state.range(1);
+    const auto& inputs = get_msm_inputs();
+    std::vector<scalar_multiplication::pippenger_runtime_state<Curve>> runtime_states;
+    for (size_t i = 0; i < NUM_NESTED_MSMS; ++i) {
+        runtime_states.emplace_back(num_points);
+    }
+    for (auto _ : state) {
+        parallel_for(NUM_NESTED_MSMS, [&](size_t i) {
+            DoNotOptimize(scalar_multiplication::pippenger_unsafe<Curve>(
+                const_cast<Fr*>(inputs.scalars.data()), inputs.points.get(), num_points, runtime_states[i]));
+        });
+    }
+    set_parallel_for_backend(ParallelForBackend::WORK_STEALING);
+}
+
+void sumcheck(State& state)
+{
+    using Flavor = UltraFlavor;
+    using FF = Flavor::FF;
+
+    set_parallel_for_backend(BACKENDS[static_cast<size_t>(state.range(0))]);
+    const auto log_circuit_size = static_cast<size_t>(state.range(1));
+    const size_t circuit_size = 1UL << log_circuit_size;
+
+    Flavor::ProverPolynomials polynomials(circuit_size);
+    for (auto& polynomial : polynomials.get_all()) {
+        for (size_t i = 0; i < circuit_size; ++i) {
+            polynomial[i] = FF::random_element();
+        }
+    }
+    Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(log_circuit_size);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element();
+    }
+
+    for (auto _ : state) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        SumcheckProver<Flavor> sumcheck(circuit_size, transcript);
+        DoNotOptimize(sumcheck.prove(polynomials, {}, alpha, gate_challenges));
+    }
+    set_parallel_for_backend(ParallelForBackend::WORK_STEALING);
+}
+
+// The first argument indexes BACKENDS
+BENCHMARK(pippenger)->ArgsProduct({ { 0, 1, 2, 3 }, { 14, 16, MAX_LOG_NUM_POINTS } })->Unit(kMillisecond);
+// A nested parallel_for corrupts the shared job of the mutex and atomic pools, so only the work-stealing and spawning
+// backends can run this one
+BENCHMARK(nested_pippenger)->ArgsProduct({ { 0, 3 }, { 14, 16 } })->Unit(kMillisecond);
+BENCHMARK(sumcheck)->ArgsProduct({ { 0, 1, 2, 3 }, { 12, 16 } })->Unit(kMillisecond);
+} // namespace
+
+BENCHMARK_MAIN();
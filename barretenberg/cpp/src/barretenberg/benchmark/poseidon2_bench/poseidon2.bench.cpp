@@ -41,4 +41,77 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+std::vector<Permutation::State> random_states(const size_t count)
+{
+    std::vector<Permutation::State> states(count);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = grumpkin::fq::random_element();
+        }
+    }
+    return states;
+}
+
+/**
+ * @brief Permutations/sec on a single core of independent states, one at a time (the scalar path)
+ */
+void poseidon2_permutation_bench(State& state) noexcept
+{
+    auto states = random_states(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& permutation_state : states) {
+            permutation_state = Permutation::permutation(permutation_state);
+        }
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_permutation_bench)->Unit(benchmark::kMicrosecond)->Arg(1024);
+
+/**
+ * @brief Permutations/sec on a single core of independent states, through the batched path
+ */
+void poseidon2_permutation_batch_bench(State& state) noexcept
+{
+    auto states = random_states(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Permutation::permutation_batch(states);
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_permutation_batch_bench)->Unit(benchmark::kMicrosecond)->Arg(1024);
+
+/**
+ * @brief Hashes/sec on a single core of pairs of field elements (e.g. merkle tree nodes), one at a time and batched
+ */
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    const bool batched = state.range(1) != 0;
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> outputs(num_pairs);
+    for (auto _ : state) {
+        if (batched) {
+            bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+        } else {
+            for (size_t i = 0; i < num_pairs; ++i) {
+                outputs[i] = poseiden_hash_impl(inputs[2 * i], inputs[2 * i + 1]);
+            }
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(poseidon2_hash_pairs_bench)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgNames({ "pairs", "batched" })
+    ->Args({ 1024, 0 })
+    ->Args({ 1024, 1 });
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "barretenberg/eccvm/eccvm_circuit_builder.hpp"
+#include "barretenberg/eccvm/eccvm_flavor.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Flavor = ECCVMFlavor;
+using FF = Flavor::FF;
+
+/**
+ * @brief Construct the ECCVM polynomials of an op queue with roughly 2^log_num_rows rows
+ */
+Flavor::ProverPolynomials construct_eccvm_polynomials(size_t log_num_rows)
+{
+    using G1 = Flavor::CycleGroup;
+    using Fr = G1::Fr;
+
+    auto op_queue = std::make_shared<ECCOpQueue>();
+    auto generators = G1::derive_generators("logderivative inverse bench", 2);
+    Fr x = Fr::random_element();
+    Fr y = Fr::random_element();
+
+    // Each iteration adds roughly 163 rows, see eccvm.bench.cpp
+    const size_t num_iterations = (1UL << log_num_rows) / 163;
+    for (size_t i = 0; i < num_iterations; i++) {
+        op_queue->add_accumulate(generators[0]);
+        op_queue->mul_accumulate(generators[0], x);
+        op_queue->mul_accumulate(generators[1], y);
+        op_queue->eq_and_reset();
+    }
+    ECCVMCircuitBuilder builder{ op_queue };
+    return Flavor::ProverPolynomials(builder);
+}
+
+/**
+ * @brief Compute the inverse polynomial of the ECCVM log-derivative lookup, i.e. the work done in
+ * ECCVMProver::execute_log_derivative_commitments_round before committing
+ */
+void eccvm_logderivative_inverse(State& state) noexcept
+{
+    auto polynomials = construct_eccvm_polynomials(static_cast<size_t>(state.range(0)));
+    const size_t circuit_size = polynomials.get_polynomial_size();
+    RelationParameters<FF> relation_parameters = RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        compute_logderivative_inverse<Flavor, Flavor::LookupRelation>(
+            polynomials, relation_parameters, circuit_size);
+        DoNotOptimize(polynomials.lookup_inverses[0]);
+    }
+}
+
+BENCHMARK(eccvm_logderivative_inverse)->Unit(kMillisecond)->DenseRange(12, 18, 2);
+
+} // namespace
+
+BENCHMARK_MAIN();
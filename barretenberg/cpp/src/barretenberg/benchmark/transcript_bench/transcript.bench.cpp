@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/stdlib/honk_recursion/verifier/ultra_recursive_verifier.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_recursive_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_recursive_flavor.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+
+using namespace benchmark;
+
+namespace bb {
+
+namespace {
+// The first argument of every benchmark selects the transcript challenge mode
+TranscriptChallengeMode challenge_mode(const State& state)
+{
+    return state.range(0) == 0 ? TranscriptChallengeMode::HASH_PER_CHALLENGE : TranscriptChallengeMode::SPLIT_SPONGE;
+}
+
+template <typename Flavor> std::shared_ptr<ProverInstance_<Flavor>> construct_instance(size_t log2_num_gates)
+{
+    typename Flavor::CircuitBuilder builder;
+    MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+    return std::make_shared<ProverInstance_<Flavor>>(builder);
+}
+} // namespace
+
+/**
+ * @brief Native proof construction time with each transcript challenge mode
+ */
+template <typename Flavor> void construct_proof(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_num_gates = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto instance = construct_instance<Flavor>(log2_num_gates);
+        state.ResumeTiming();
+        UltraProver_<Flavor> prover(instance, std::make_shared<typename Flavor::Transcript>(challenge_mode(state)));
+        DoNotOptimize(prover.construct_proof());
+    }
+}
+
+/**
+ * @brief Time and gate count (reported as the "gates" counter) of the recursive verifier of a proof, with each
+ * transcript challenge mode
+ */
+template <typename RecursiveFlavor> void recursive_verifier(State& state) noexcept
+{
+    using InnerFlavor = typename RecursiveFlavor::NativeFlavor;
+    using OuterBuilder = typename RecursiveFlavor::CircuitBuilder;
+    using RecursiveVerifier = stdlib::recursion::honk::UltraRecursiveVerifier_<RecursiveFlavor>;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_num_gates = static_cast<size_t>(state.range(1));
+
+    auto instance = construct_instance<InnerFlavor>(log2_num_gates);
+    UltraProver_<InnerFlavor> prover(instance,
+                                     std::make_shared<typename InnerFlavor::Transcript>(challenge_mode(state)));
+    auto verification_key = std::make_shared<typename InnerFlavor::VerificationKey>(instance->proving_key);
+    auto proof = prover.construct_proof();
+
+    for (auto _ : state) {
+        OuterBuilder outer_circuit;
+        RecursiveVerifier verifier{ &outer_circuit, verification_key, challenge_mode(state) };
+        DoNotOptimize(verifier.verify_proof(proof));
+        state.counters["gates"] = static_cast<double>(outer_circuit.get_num_gates());
+    }
+}
+
+// The arguments are the challenge mode (0: HASH_PER_CHALLENGE, 1: SPLIT_SPONGE) and the log of the circuit size
+BENCHMARK(construct_proof<UltraFlavor>)->ArgsProduct({ { 0, 1 }, { 12, 16 } })->Unit(kMillisecond);
+BENCHMARK(construct_proof<MegaFlavor>)->ArgsProduct({ { 0, 1 }, { 12, 16 } })->Unit(kMillisecond);
+BENCHMARK(recursive_verifier<UltraRecursiveFlavor_<UltraCircuitBuilder>>)
+    ->ArgsProduct({ { 0, 1 }, { 12, 16 } })
+    ->Unit(kMillisecond);
+BENCHMARK(recursive_verifier<MegaRecursiveFlavor_<MegaCircuitBuilder>>)
+    ->ArgsProduct({ { 0, 1 }, { 12, 16 } })
+    ->Unit(kMillisecond);
+
+} // namespace bb
+
+BENCHMARK_MAIN();
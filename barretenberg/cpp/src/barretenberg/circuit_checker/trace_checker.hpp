@@ -0,0 +1,267 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A subrelation of a trace-based circuit that does not hold
+ */
+struct TraceCheckFailure {
+    // Index of the relation in the order it was added to the TraceChecker
+    size_t relation_index;
+    std::string relation_name;
+    std::string subrelation_label;
+    size_t subrelation_index;
+    bool is_lookup;
+    // The failing row, or std::nullopt for a linearly dependent subrelation, which is a sum over the whole trace
+    std::optional<size_t> row;
+
+    std::string message() const
+    {
+        if (!row.has_value()) {
+            return format(is_lookup ? "Lookup " : "Relation ", relation_name, " failed.");
+        }
+        return format(is_lookup ? "Lookup " : "Relation ",
+                      relation_name,
+                      ", subrelation index ",
+                      subrelation_label,
+                      " failed at row ",
+                      *row);
+    }
+
+    bool operator<(const TraceCheckFailure& other) const
+    {
+        // Failures without a row come last for their relation. Several subrelations can fail on the same row, so the
+        // subrelation index is part of the key to make the order total.
+        return std::make_tuple(relation_index, row.value_or(SIZE_MAX), subrelation_index) <
+               std::make_tuple(other.relation_index, other.row.value_or(SIZE_MAX), other.subrelation_index);
+    }
+};
+
+/**
+ * @brief Checks the relations and lookups of a trace-based circuit (e.g. the AVM) against its polynomials
+ *
+ * @details The trace is split into chunks of rows, and the relations into groups, and every (chunk, group) pair is
+ * evaluated as a separate job of a single parallel_for. A job fetches each of its rows once and evaluates all the
+ * relations of its group on it, accumulating the linearly dependent subrelations into per-job sums that are added up
+ * once all jobs have finished. The inverse polynomials of the lookups are computed up front, in parallel across
+ * lookups.
+ *
+ * With `stop_at_first_failure`, jobs stop as soon as the failure they could report can no longer be the first one in
+ * (relation, row, subrelation) order, and `run` returns only that first failure. This is the same failure that a
+ * sequential check would have reported. Otherwise `run` returns every failing (relation, row, subrelation).
+ */
+template <typename Flavor> class TraceChecker {
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    // Relations read the rows in place, without copying them
+    using RowValues = typename ProverPolynomials::RowView;
+
+  public:
+    static constexpr size_t MIN_ROWS_PER_CHUNK = 1 << 10;
+
+    TraceChecker(ProverPolynomials& polynomials,
+                 const size_t num_rows,
+                 const RelationParameters<FF>& relation_parameters,
+                 const bool stop_at_first_failure)
+        : polynomials(polynomials)
+        , num_rows(num_rows)
+        , relation_parameters(relation_parameters)
+        , stop_at_first_failure(stop_at_first_failure)
+    {}
+
+    /**
+     * @param debug_label Maps a subrelation index to its name in the PIL file
+     */
+    template <typename Relation> void add_relation(const std::string& name, std::string (*debug_label)(int))
+    {
+        add_check<Relation>(name, [debug_label](size_t j) { return debug_label(static_cast<int>(j)); }, false);
+    }
+
+    template <typename LookupSettings> void add_lookup(const std::string& name)
+    {
+        add_check<LookupSettings>(name, [](size_t j) { return std::to_string(j); }, true);
+        compute_inverses.emplace_back([this]() {
+            compute_logderivative_inverse<Flavor, LookupSettings>(polynomials, relation_parameters, num_rows);
+        });
+    }
+
+    /**
+     * @return The failing subrelations, ordered by relation, row and subrelation. Empty if the circuit is satisfied.
+     */
+    std::vector<TraceCheckFailure> run()
+    {
+        parallel_for(compute_inverses.size(), [&](size_t i) { compute_inverses[i](); });
+
+        const size_t num_threads = get_num_cpus();
+        const size_t num_chunks =
+            std::max<size_t>(std::min(num_threads * 4, num_rows / MIN_ROWS_PER_CHUNK), num_rows > 0 ? 1 : 0);
+        // Only split the relations into several groups when there are too few chunks to keep every thread busy
+        const size_t num_groups_for_threads = (num_threads * 4 + num_chunks - 1) / std::max<size_t>(num_chunks, 1);
+        const size_t num_groups = std::clamp<size_t>(num_groups_for_threads, 1, std::max<size_t>(checks.size(), 1));
+        for (auto& check : checks) {
+            check->start(num_chunks);
+        }
+
+        std::vector<std::vector<TraceCheckFailure>> job_failures(num_chunks * num_groups);
+        parallel_for(num_chunks * num_groups, [&](size_t job_idx) {
+            const size_t chunk_idx = job_idx / num_groups;
+            const size_t group_idx = job_idx % num_groups;
+            const size_t row_start = (num_rows * chunk_idx) / num_chunks;
+            const size_t row_end = (num_rows * (chunk_idx + 1)) / num_chunks;
+            const size_t check_start = (checks.size() * group_idx) / num_groups;
+            const size_t check_end = (checks.size() * (group_idx + 1)) / num_groups;
+            auto& failures = job_failures[job_idx];
+
+            for (size_t i = row_start; i < row_end; ++i) {
+                bool done = true;
+                const RowValues row = polynomials.get_row_view(i);
+                for (size_t c = check_start; c < check_end; ++c) {
+                    Check& check = *checks[c];
+                    if (stop_at_first_failure && !can_be_first_failure(c, i)) {
+                        continue;
+                    }
+                    done = false;
+                    if (check.evaluate_row(row, i, chunk_idx, failures) && stop_at_first_failure) {
+                        record_failure(c, i);
+                    }
+                }
+                if (done) {
+                    break;
+                }
+            }
+        });
+
+        std::vector<TraceCheckFailure> failures;
+        for (auto& job : job_failures) {
+            failures.insert(failures.end(), job.begin(), job.end());
+        }
+        for (size_t c = 0; c < checks.size(); ++c) {
+            if (stop_at_first_failure && !can_be_first_failure(c, SIZE_MAX)) {
+                continue;
+            }
+            checks[c]->finalize(failures);
+        }
+        std::sort(failures.begin(), failures.end());
+        if (stop_at_first_failure && failures.size() > 1) {
+            failures.resize(1);
+        }
+        return failures;
+    }
+
+  private:
+    struct Check {
+        // Evaluates one row into the given job's list of failures. Returns true if the row failed.
+        std::function<bool(const RowValues&, size_t, size_t, std::vector<TraceCheckFailure>&)> evaluate_row;
+        // Called before the jobs start, with the number of chunks
+        std::function<void(size_t)> start;
+        // Checks the sums of the linearly dependent subrelations
+        std::function<void(std::vector<TraceCheckFailure>&)> finalize;
+    };
+
+    ProverPolynomials& polynomials;
+    const size_t num_rows;
+    const RelationParameters<FF> relation_parameters;
+    const bool stop_at_first_failure;
+    std::vector<std::unique_ptr<Check>> checks;
+    std::vector<std::function<void()>> compute_inverses;
+    // In stop_at_first_failure mode, the smallest (relation index, row) known to fail, packed as relation * num_rows
+    // + row so that it can be updated atomically
+    std::atomic<size_t> first_failure = SIZE_MAX;
+
+    bool can_be_first_failure(size_t check_idx, size_t row) const
+    {
+        const size_t first = first_failure.load(std::memory_order_relaxed);
+        if (first == SIZE_MAX) {
+            return true;
+        }
+        const size_t first_check = first / std::max<size_t>(num_rows, 1);
+        return check_idx < first_check || (check_idx == first_check && row < first % std::max<size_t>(num_rows, 1));
+    }
+
+    void record_failure(size_t check_idx, size_t row)
+    {
+        const size_t packed = check_idx * num_rows + row;
+        size_t current = first_failure.load(std::memory_order_relaxed);
+        while (packed < current && !first_failure.compare_exchange_weak(current, packed)) {
+        }
+    }
+
+    template <typename Relation, typename Label>
+    void add_check(const std::string& name, Label subrelation_label, bool is_lookup)
+    {
+        using SubrelationValues = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+        constexpr size_t NUM_SUBRELATIONS = std::tuple_size_v<SubrelationValues>;
+
+        const size_t check_idx = checks.size();
+        auto check = std::make_unique<Check>();
+        // Sums of the linearly dependent subrelations, one per chunk
+        auto partial_sums = std::make_shared<std::vector<SubrelationValues>>();
+
+        check->start = [partial_sums](size_t num_chunks) {
+            SubrelationValues zero;
+            for (auto& value : zero) {
+                value = 0;
+            }
+            partial_sums->assign(num_chunks, zero);
+        };
+
+        check->evaluate_row = [this, partial_sums, name, subrelation_label, is_lookup, check_idx](
+                                  const RowValues& row,
+                                  size_t row_idx,
+                                  size_t chunk_idx,
+                                  std::vector<TraceCheckFailure>& failures) {
+            SubrelationValues values;
+            for (auto& value : values) {
+                value = 0;
+            }
+            Relation::accumulate(values, row, relation_parameters, 1);
+
+            bool failed = false;
+            auto& sums = (*partial_sums)[chunk_idx];
+            bb::constexpr_for<0, NUM_SUBRELATIONS, 1>([&]<size_t j>() {
+                if constexpr (subrelation_is_linearly_independent<Relation, j>()) {
+                    if (values[j] != 0) {
+                        failures.push_back({ check_idx, name, subrelation_label(j), j, is_lookup, row_idx });
+                        failed = true;
+                    }
+                } else {
+                    sums[j] += values[j];
+                }
+            });
+            return failed;
+        };
+
+        check->finalize = [partial_sums, name, subrelation_label, is_lookup, check_idx](
+                              std::vector<TraceCheckFailure>& failures) {
+            bb::constexpr_for<0, NUM_SUBRELATIONS, 1>([&]<size_t j>() {
+                if constexpr (!subrelation_is_linearly_independent<Relation, j>()) {
+                    FF sum = 0;
+                    for (const auto& chunk_sums : *partial_sums) {
+                        sum += chunk_sums[j];
+                    }
+                    if (sum != 0) {
+                        failures.push_back({ check_idx, name, subrelation_label(j), j, is_lookup, std::nullopt });
+                    }
+                }
+            });
+        };
+
+        checks.emplace_back(std::move(check));
+    }
+};
+
+} // namespace bb
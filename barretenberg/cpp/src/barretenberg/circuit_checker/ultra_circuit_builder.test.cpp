@@ -211,7 +211,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation)
     EXPECT_EQ(result, true);
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.variable_classes[a_idx]] = 2;
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
 }
 
@@ -253,7 +253,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation_and_cycles)
     EXPECT_EQ(result, true);
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.variable_classes[a_idx]] = 2;
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
 }
 TEST(ultra_circuit_constructor, bad_tag_permutation)
@@ -847,4 +847,135 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), true);
 }
 
-} // namespace bb
\ No newline at end of file
+TEST(ultra_circuit_constructor, check_report_lists_every_failure)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    // Enough gates for the arithmetic block to be split into several chunks, two of which are unsatisfied
+    std::vector<size_t> bad_rows;
+    for (size_t i = 0; i < 4 * UltraCircuitChecker::MIN_ROWS_PER_CHUNK; ++i) {
+        const bool is_bad = (i == 3 || i == 3 * UltraCircuitChecker::MIN_ROWS_PER_CHUNK);
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = circuit_constructor.add_variable(a);
+        uint32_t b_idx = circuit_constructor.add_variable(b);
+        uint32_t c_idx = circuit_constructor.add_variable(is_bad ? a + b + 1 : a + b);
+        if (is_bad) {
+            bad_rows.push_back(circuit_constructor.blocks.arithmetic.size());
+        }
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+    }
+    size_t arithmetic_block_idx = 0;
+    auto blocks = circuit_constructor.blocks.get();
+    while (&blocks[arithmetic_block_idx] != &circuit_constructor.blocks.arithmetic) {
+        arithmetic_block_idx++;
+    }
+
+    EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
+
+    auto failures = UltraCircuitChecker::check_report(circuit_constructor);
+    ASSERT_EQ(failures.size(), bad_rows.size());
+    for (size_t i = 0; i < failures.size(); ++i) {
+        EXPECT_EQ(failures[i].block_idx, arithmetic_block_idx);
+        EXPECT_EQ(failures[i].row_idx, bad_rows[i]);
+        EXPECT_EQ(failures[i].relation_name, "Arithmetic");
+        EXPECT_EQ(failures[i].subrelation_idx, 0);
+    }
+}
+
+TEST(ultra_circuit_constructor, check_reports_lowest_failure_first)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    // Unsatisfied gates in several chunks of the arithmetic block, none of them in its first chunk
+    std::vector<size_t> bad_rows;
+    for (size_t i = 0; i < 4 * UltraCircuitChecker::MIN_ROWS_PER_CHUNK; ++i) {
+        const bool is_bad = (i == UltraCircuitChecker::MIN_ROWS_PER_CHUNK + 5 ||
+                             i == 2 * UltraCircuitChecker::MIN_ROWS_PER_CHUNK + 7 ||
+                             i == 3 * UltraCircuitChecker::MIN_ROWS_PER_CHUNK + 1);
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = circuit_constructor.add_variable(a);
+        uint32_t b_idx = circuit_constructor.add_variable(b);
+        uint32_t c_idx = circuit_constructor.add_variable(is_bad ? a + b + 1 : a + b);
+        if (is_bad) {
+            bad_rows.push_back(circuit_constructor.blocks.arithmetic.size());
+        }
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+    }
+    // An unsatisfied sort constraint in the first rows of the later delta range block
+    auto sort_a_idx = circuit_constructor.add_variable(fr(1));
+    auto sort_b_idx = circuit_constructor.add_variable(fr(2));
+    auto sort_c_idx = circuit_constructor.add_variable(fr(3));
+    auto sort_d_idx = circuit_constructor.add_variable(fr(8));
+    circuit_constructor.create_sort_constraint({ sort_a_idx, sort_b_idx, sort_c_idx, sort_d_idx });
+
+    size_t arithmetic_block_idx = 0;
+    size_t delta_range_block_idx = 0;
+    auto blocks = circuit_constructor.blocks.get();
+    for (size_t idx = 0; idx < blocks.size(); ++idx) {
+        if (&blocks[idx] == &circuit_constructor.blocks.arithmetic) {
+            arithmetic_block_idx = idx;
+        }
+        if (&blocks[idx] == &circuit_constructor.blocks.delta_range) {
+            delta_range_block_idx = idx;
+        }
+    }
+    ASSERT_LT(arithmetic_block_idx, delta_range_block_idx);
+
+    EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
+
+    auto first_failure = UltraCircuitChecker::find_first_failure(circuit_constructor);
+    ASSERT_TRUE(first_failure.has_value());
+    EXPECT_EQ(first_failure->block_idx, arithmetic_block_idx);
+    EXPECT_EQ(first_failure->row_idx, bad_rows.front());
+    EXPECT_EQ(first_failure->relation_name, "Arithmetic");
+    EXPECT_EQ(first_failure->subrelation_idx, 0);
+
+    // The first failure is also the first entry of the full report, which continues into the delta range block
+    auto failures = UltraCircuitChecker::check_report(circuit_constructor);
+    ASSERT_GT(failures.size(), bad_rows.size());
+    EXPECT_EQ(failures.front().message(), first_failure->message());
+    for (size_t i = 0; i < bad_rows.size(); ++i) {
+        EXPECT_EQ(failures[i].block_idx, arithmetic_block_idx);
+        EXPECT_EQ(failures[i].row_idx, bad_rows[i]);
+    }
+    EXPECT_EQ(failures.back().block_idx, delta_range_block_idx);
+}
+
+TEST(ultra_circuit_constructor, check_report_tag_failure_only)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    fr a = fr::random_element();
+    fr b = -a;
+
+    auto a_idx = circuit_constructor.add_variable(a);
+    auto b_idx = circuit_constructor.add_variable(b);
+    auto c_idx = circuit_constructor.add_variable(b);
+    auto d_idx = circuit_constructor.add_variable(a + 1);
+
+    circuit_constructor.create_add_gate({ a_idx, b_idx, circuit_constructor.zero_idx, 1, 1, 0, 0 });
+    circuit_constructor.create_add_gate({ c_idx, d_idx, circuit_constructor.zero_idx, 1, 1, 0, -1 });
+
+    circuit_constructor.create_tag(1, 2);
+    circuit_constructor.create_tag(2, 1);
+
+    circuit_constructor.assign_tag(a_idx, 1);
+    circuit_constructor.assign_tag(b_idx, 1);
+    circuit_constructor.assign_tag(c_idx, 2);
+    circuit_constructor.assign_tag(d_idx, 2);
+
+    // Every gate holds, only the tag check over the whole trace fails
+    auto failures = UltraCircuitChecker::check_report(circuit_constructor);
+    ASSERT_EQ(failures.size(), 1);
+    EXPECT_EQ(failures[0].relation_name, "tag");
+    EXPECT_FALSE(failures[0].block_idx.has_value());
+    EXPECT_FALSE(failures[0].row_idx.has_value());
+    EXPECT_FALSE(failures[0].subrelation_idx.has_value());
+
+    auto first_failure = UltraCircuitChecker::find_first_failure(circuit_constructor);
+    ASSERT_TRUE(first_failure.has_value());
+    EXPECT_EQ(first_failure->relation_name, "tag");
+}
+
+} // namespace bb
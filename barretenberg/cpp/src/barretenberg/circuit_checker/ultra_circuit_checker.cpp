@@ -1,5 +1,7 @@
 #include "ultra_circuit_checker.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_set>
 
@@ -16,6 +18,33 @@ template <> auto UltraCircuitChecker::init_empty_values<MegaCircuitBuilder_<bb::
 }
 
 template <typename Builder> bool UltraCircuitChecker::check(const Builder& builder_in)
+{
+    auto failure = find_first_failure(builder_in);
+    if (failure.has_value()) {
+        info(failure->message());
+        return false;
+    }
+    return true;
+};
+
+template <typename Builder>
+std::optional<UltraCircuitCheckFailure> UltraCircuitChecker::find_first_failure(const Builder& builder_in)
+{
+    auto failures = check_all</*stop_at_first_failure=*/true>(builder_in);
+    if (failures.empty()) {
+        return std::nullopt;
+    }
+    return failures.front();
+};
+
+template <typename Builder>
+std::vector<UltraCircuitCheckFailure> UltraCircuitChecker::check_report(const Builder& builder_in)
+{
+    return check_all</*stop_at_first_failure=*/false>(builder_in);
+};
+
+template <bool stop_at_first_failure, typename Builder>
+std::vector<UltraCircuitCheckFailure> UltraCircuitChecker::check_all(const Builder& builder_in)
 {
     // Create a copy of the input circuit and finalize it
     Builder builder{ builder_in };
@@ -30,39 +59,86 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
         }
     }
 
-    // Instantiate structs used for checking tag and memory record correctness
-    TagCheckData tag_data;
-    MemoryCheckData memory_data{ builder };
+    // Instantiate struct used for checking memory record correctness
+    const MemoryCheckData memory_data{ builder };
+
+    // Split each block into chunks of rows, in (block, row) order
+    struct Chunk {
+        size_t block_idx;
+        size_t row_start;
+        size_t row_end;
+    };
+    auto blocks = builder.blocks.get();
+    const size_t max_chunks_per_block = get_num_cpus() * 4;
+    std::vector<Chunk> chunks;
+    for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+        const size_t block_size = blocks[block_idx].size();
+        const size_t num_chunks = std::clamp<size_t>(block_size / MIN_ROWS_PER_CHUNK, 1, max_chunks_per_block);
+        for (size_t chunk_idx = 0; chunk_idx < num_chunks && block_size > 0; ++chunk_idx) {
+            chunks.push_back(
+                { block_idx, block_size * chunk_idx / num_chunks, block_size * (chunk_idx + 1) / num_chunks });
+        }
+    }
 
-    bool result = true;
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): Currently we check all relations for each block.
     // Once sorting is complete, is will be sufficient to check only the relevant relation(s) per block.
-    size_t block_idx = 0;
-    for (auto& block : builder.blocks.get()) {
-        result = result && check_block(builder, block, tag_data, memory_data, lookup_hash_table);
-        if (result == false) {
-            info("Failed at block idx = ", block_idx);
-            return false;
+    std::vector<std::vector<UltraCircuitCheckFailure>> chunk_failures(chunks.size());
+    // When stopping at the first failure, the first chunk known to fail; later chunks cannot contain the first failure
+    std::atomic<size_t> first_failed_chunk = SIZE_MAX;
+    parallel_for(chunks.size(), [&](size_t chunk_idx) {
+        const auto& chunk = chunks[chunk_idx];
+        auto& failures = chunk_failures[chunk_idx];
+        // Resolved at compile time, so the full report pays nothing per row
+        auto should_stop = [&]() {
+            if constexpr (stop_at_first_failure) {
+                return !failures.empty() || chunk_idx > first_failed_chunk.load(std::memory_order_relaxed);
+            } else {
+                return false;
+            }
+        };
+        check_block(builder,
+                    blocks[chunk.block_idx],
+                    chunk.block_idx,
+                    chunk.row_start,
+                    chunk.row_end,
+                    memory_data,
+                    lookup_hash_table,
+                    failures,
+                    should_stop);
+        if (stop_at_first_failure && !failures.empty()) {
+            size_t current = first_failed_chunk.load(std::memory_order_relaxed);
+            while (chunk_idx < current && !first_failed_chunk.compare_exchange_weak(current, chunk_idx)) {
+            }
+        }
+    });
+
+    std::vector<UltraCircuitCheckFailure> failures;
+    for (auto& chunk : chunk_failures) {
+        failures.insert(failures.end(), chunk.begin(), chunk.end());
+        if (stop_at_first_failure && !failures.empty()) {
+            failures.resize(1);
+            return failures;
         }
-        block_idx++;
     }
 
     // Tag check is only expected to pass after entire execution trace (all blocks) have been processed
-    result = result && check_tag_data(tag_data);
-    if (result == false) {
-        info("Failed tag check.");
-        return false;
+    if (!check_tags(builder, memory_data)) {
+        failures.push_back({ std::nullopt, std::nullopt, "tag", std::nullopt });
     }
 
-    return result;
+    return failures;
 };
 
-template <typename Builder>
-bool UltraCircuitChecker::check_block(Builder& builder,
+template <typename Builder, typename ShouldStop>
+void UltraCircuitChecker::check_block(Builder& builder,
                                       auto& block,
-                                      TagCheckData& tag_data,
-                                      MemoryCheckData& memory_data,
-                                      LookupHashTable& lookup_hash_table)
+                                      size_t block_idx,
+                                      size_t row_start,
+                                      size_t row_end,
+                                      const MemoryCheckData& memory_data,
+                                      const LookupHashTable& lookup_hash_table,
+                                      std::vector<UltraCircuitCheckFailure>& failures,
+                                      const ShouldStop& should_stop)
 {
     // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
     auto values = init_empty_values<Builder>();
@@ -72,63 +148,33 @@ bool UltraCircuitChecker::check_block(Builder& builder,
     params.eta_three = memory_data.eta_three;
 
     // Perform checks on each gate defined in the builder
-    bool result = true;
-    for (size_t idx = 0; idx < block.size(); ++idx) {
+    for (size_t idx = row_start; idx < row_end && !should_stop(); ++idx) {
 
-        populate_values(builder, block, values, tag_data, memory_data, idx);
+        populate_values(builder, block, values, memory_data, idx);
 
-        result = result && check_relation<Arithmetic>(values, params);
-        if (result == false) {
-            info("Failed Arithmetic relation at row idx = ", idx);
-            return false;
-        }
-        result = result && check_relation<Elliptic>(values, params);
-        if (result == false) {
-            info("Failed Elliptic relation at row idx = ", idx);
-            return false;
-        }
-        result = result && check_relation<Auxiliary>(values, params);
-        if (result == false) {
-            info("Failed Auxiliary relation at row idx = ", idx);
-            return false;
-        }
-        result = result && check_relation<DeltaRangeConstraint>(values, params);
-        if (result == false) {
-            info("Failed DeltaRangeConstraint relation at row idx = ", idx);
-            return false;
-        }
-        result = result && check_lookup(values, lookup_hash_table);
-        if (result == false) {
-            info("Failed Lookup check relation at row idx = ", idx);
-            return false;
+        auto report = [&](const char* relation_name) {
+            return [&failures, block_idx, idx, relation_name](std::optional<size_t> subrelation_idx) {
+                failures.push_back({ block_idx, idx, relation_name, subrelation_idx });
+            };
+        };
+        check_relation<Arithmetic>(values, params, report("Arithmetic"));
+        check_relation<Elliptic>(values, params, report("Elliptic"));
+        check_relation<Auxiliary>(values, params, report("Auxiliary"));
+        check_relation<DeltaRangeConstraint>(values, params, report("DeltaRangeConstraint"));
+        if (!check_lookup(values, lookup_hash_table)) {
+            report("Lookup")(std::nullopt);
         }
         if constexpr (IsMegaBuilder<Builder>) {
-            result = result && check_relation<PoseidonInternal>(values, params);
-            if (result == false) {
-                info("Failed PoseidonInternal relation at row idx = ", idx);
-                return false;
+            check_relation<PoseidonInternal>(values, params, report("PoseidonInternal"));
+            check_relation<PoseidonExternal>(values, params, report("PoseidonExternal"));
+            if (!check_databus_read(values, builder)) {
+                report("databus read")(std::nullopt);
             }
-            result = result && check_relation<PoseidonExternal>(values, params);
-            if (result == false) {
-                info("Failed PoseidonExternal relation at row idx = ", idx);
-                return false;
-            }
-            result = result && check_databus_read(values, builder);
-            if (result == false) {
-                info("Failed databus read at row idx = ", idx);
-                return false;
-            }
-        }
-        if (result == false) {
-            info("Failed at row idx = ", idx);
-            return false;
         }
     }
-
-    return result;
 };
 
-template <typename Relation> bool UltraCircuitChecker::check_relation(auto& values, auto& params)
+template <typename Relation> bool UltraCircuitChecker::check_relation(auto& values, auto& params, const auto& report)
 {
     // Define zero initialized array to store the evaluation of each sub-relation
     using SubrelationEvaluations = typename Relation::SumcheckArrayOfValuesOverSubrelations;
@@ -141,12 +187,14 @@ template <typename Relation> bool UltraCircuitChecker::check_relation(auto& valu
     Relation::accumulate(subrelation_evaluations, values, params, /*scaling_factor=*/1);
 
     // Ensure each subrelation evaluates to zero
-    for (auto& eval : subrelation_evaluations) {
-        if (eval != 0) {
-            return false;
+    bool result = true;
+    for (size_t subrelation_idx = 0; subrelation_idx < subrelation_evaluations.size(); ++subrelation_idx) {
+        if (subrelation_evaluations[subrelation_idx] != 0) {
+            report(subrelation_idx);
+            result = false;
         }
     }
-    return true;
+    return result;
 }
 
 bool UltraCircuitChecker::check_lookup(auto& values, auto& lookup_hash_table)
@@ -176,11 +224,11 @@ template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& v
         // Check that the claimed value is present in the calldata/return data at the corresponding index
         FF bus_value;
         if (is_calldata_read) {
-            auto calldata = builder.get_calldata();
+            const auto& calldata = builder.get_calldata();
             bus_value = builder.get_variable(calldata[raw_read_idx]);
         }
         if (is_return_data_read) {
-            auto return_data = builder.get_return_data();
+            const auto& return_data = builder.get_return_data();
             bus_value = builder.get_variable(return_data[raw_read_idx]);
         }
         return (value == bus_value);
@@ -188,78 +236,70 @@ template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& v
     return true;
 };
 
-bool UltraCircuitChecker::check_tag_data(const TagCheckData& tag_data)
+template <typename Builder>
+bool UltraCircuitChecker::check_tags(Builder& builder, const MemoryCheckData& memory_data)
 {
+    TagCheckData tag_data{ builder.variables.size() };
+    for (auto& block : builder.blocks.get()) {
+        for (size_t idx = 0; idx < block.size(); ++idx) {
+            for (size_t wire_idx = 0; wire_idx < Builder::NUM_WIRES; ++wire_idx) {
+                const uint32_t variable_index = block.wires[wire_idx][idx];
+                const size_t real_index = builder.variable_classes[variable_index];
+                const uint32_t tag_in = builder.real_variable_tags[real_index];
+                // Check to ensure that we are not including a variable twice
+                if (tag_in == DUMMY_TAG || tag_data.encountered_variables[real_index]) {
+                    continue;
+                }
+                // The value of the 4th wire may be a memory record rather than the value of the variable
+                const FF value = (wire_idx == 3) ? get_w_4(builder, block, memory_data, idx)
+                                                 : builder.get_variable(variable_index);
+                const uint32_t tag_out = builder.tau.at(tag_in);
+                tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
+                tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
+                tag_data.encountered_variables[real_index] = true;
+            }
+        }
+    }
     return tag_data.left_product == tag_data.right_product;
 };
 
 template <typename Builder>
-void UltraCircuitChecker::populate_values(
-    Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx)
+UltraCircuitChecker::FF UltraCircuitChecker::get_w_4(Builder& builder,
+                                                     auto& block,
+                                                     const MemoryCheckData& memory_data,
+                                                     size_t idx)
 {
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_data = [&](const size_t variable_index, const FF& value) {
-        size_t real_index = builder.real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (tag_data.encountered_variables.contains(real_index)) {
-            return;
-        }
-        uint32_t tag_in = builder.real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            uint32_t tag_out = builder.tau.at(tag_in);
-            tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
-            tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
-            tag_data.encountered_variables.insert(real_index);
+    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that we
+    // are indexing into the correct block before using a memory record.
+    if (block.has_ram_rom) {
+        const bool is_read = memory_data.read_record_gates.contains(idx);
+        if (is_read || memory_data.write_record_gates.contains(idx)) {
+            // A memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta, plus one for writes
+            FF record = builder.get_variable(block.w_o()[idx]) * memory_data.eta_three +
+                        builder.get_variable(block.w_r()[idx]) * memory_data.eta_two +
+                        builder.get_variable(block.w_l()[idx]) * memory_data.eta;
+            return is_read ? record : record + FF::one();
         }
-    };
-
-    // A lambda function for computing a memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta
-    auto compute_memory_record_term =
-        [](const FF& w_1, const FF& w_2, const FF& w_3, const FF& eta, const FF& eta_two, FF& eta_three) {
-            return (w_3 * eta_three + w_2 * eta_two + w_1 * eta);
-        };
+    }
+    return builder.get_variable(block.w_4()[idx]);
+}
 
+template <typename Builder>
+void UltraCircuitChecker::populate_values(
+    Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx)
+{
     // Set wire values. Wire 4 is treated specially since it may contain memory records
     values.w_l = builder.get_variable(block.w_l()[idx]);
     values.w_r = builder.get_variable(block.w_r()[idx]);
     values.w_o = builder.get_variable(block.w_o()[idx]);
-    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that we
-    // are indexing into the correct block before updating the w_4 value.
-    if (block.has_ram_rom && memory_data.read_record_gates.contains(idx)) {
-        values.w_4 = compute_memory_record_term(
-            values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three);
-    } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx)) {
-        values.w_4 =
-            compute_memory_record_term(
-                values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three) +
-            FF::one();
-    } else {
-        values.w_4 = builder.get_variable(block.w_4()[idx]);
-    }
+    values.w_4 = get_w_4(builder, block, memory_data, idx);
 
     // Set shifted wire values. Again, wire 4 is treated specially. On final row, set shift values to zero
     if (idx < block.size() - 1) {
         values.w_l_shift = builder.get_variable(block.w_l()[idx + 1]);
         values.w_r_shift = builder.get_variable(block.w_r()[idx + 1]);
         values.w_o_shift = builder.get_variable(block.w_o()[idx + 1]);
-        if (block.has_ram_rom && memory_data.read_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three);
-        } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three) +
-                               FF::one();
-        } else {
-            values.w_4_shift = builder.get_variable(block.w_4()[idx + 1]);
-        }
+        values.w_4_shift = get_w_4(builder, block, memory_data, idx + 1);
     } else {
         values.w_l_shift = 0;
         values.w_r_shift = 0;
@@ -267,12 +307,6 @@ void UltraCircuitChecker::populate_values(
         values.w_4_shift = 0;
     }
 
-    // Update tag check data
-    update_tag_check_data(block.w_l()[idx], values.w_l);
-    update_tag_check_data(block.w_r()[idx], values.w_r);
-    update_tag_check_data(block.w_o()[idx], values.w_o);
-    update_tag_check_data(block.w_4()[idx], values.w_4);
-
     // Set selector values
     values.q_m = block.q_m()[idx];
     values.q_c = block.q_c()[idx];
@@ -296,4 +330,12 @@ void UltraCircuitChecker::populate_values(
 template bool UltraCircuitChecker::check<UltraCircuitBuilder_<UltraArith<bb::fr>>>(
     const UltraCircuitBuilder_<UltraArith<bb::fr>>& builder_in);
 template bool UltraCircuitChecker::check<MegaCircuitBuilder_<bb::fr>>(const MegaCircuitBuilder_<bb::fr>& builder_in);
+template std::optional<UltraCircuitCheckFailure> UltraCircuitChecker::find_first_failure<
+    UltraCircuitBuilder_<UltraArith<bb::fr>>>(const UltraCircuitBuilder_<UltraArith<bb::fr>>& builder_in);
+template std::optional<UltraCircuitCheckFailure> UltraCircuitChecker::find_first_failure<MegaCircuitBuilder_<bb::fr>>(
+    const MegaCircuitBuilder_<bb::fr>& builder_in);
+template std::vector<UltraCircuitCheckFailure> UltraCircuitChecker::check_report<
+    UltraCircuitBuilder_<UltraArith<bb::fr>>>(const UltraCircuitBuilder_<UltraArith<bb::fr>>& builder_in);
+template std::vector<UltraCircuitCheckFailure> UltraCircuitChecker::check_report<MegaCircuitBuilder_<bb::fr>>(
+    const MegaCircuitBuilder_<bb::fr>& builder_in);
 } // namespace bb
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/relations/auxiliary_relation.hpp"
 #include "barretenberg/relations/delta_range_constraint_relation.hpp"
 #include "barretenberg/relations/ecc_op_queue_relation.hpp"
@@ -12,9 +13,42 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace bb {
 
+/**
+ * @brief A check of the UltraCircuitChecker that does not hold
+ */
+struct UltraCircuitCheckFailure {
+    // The execution trace block and the row within it, or std::nullopt for the tag check, which only holds over the
+    // whole trace
+    std::optional<size_t> block_idx;
+    std::optional<size_t> row_idx;
+    std::string relation_name;
+    // The failing subrelation, or std::nullopt for checks that are not relations (lookups, databus reads, tags)
+    std::optional<size_t> subrelation_idx;
+
+    std::string message() const
+    {
+        if (!row_idx.has_value()) {
+            return format("Failed ", relation_name, " check.");
+        }
+        if (!subrelation_idx.has_value()) {
+            return format("Failed ", relation_name, " check at block idx = ", *block_idx, ", row idx = ", *row_idx);
+        }
+        return format("Failed ",
+                      relation_name,
+                      " relation, subrelation idx = ",
+                      *subrelation_idx,
+                      " at block idx = ",
+                      *block_idx,
+                      ", row idx = ",
+                      *row_idx);
+    }
+};
+
 class UltraCircuitChecker {
   public:
     using FF = bb::fr;
@@ -40,6 +74,31 @@ class UltraCircuitChecker {
      */
     template <typename Builder> static bool check(const Builder& builder);
 
+    /**
+     * @brief Find the failure that `check` reports
+     * @details Stops checking once a failure is found. The failure returned is the one with the lowest (block, row),
+     * i.e. the one a sequential check would find first, regardless of the order in which the chunks are checked.
+     *
+     * @tparam Builder
+     * @param builder
+     * @return The first failure, or std::nullopt if `check` passes
+     */
+    template <typename Builder>
+    static std::optional<UltraCircuitCheckFailure> find_first_failure(const Builder& builder);
+
+    /**
+     * @brief Check the correctness of a circuit witness and report every check that fails
+     * @details Performs the same checks as `check` but does not stop at the first failure.
+     *
+     * @tparam Builder
+     * @param builder
+     * @return The failures in (block, row) order followed by the tag check, if it fails. Empty if `check` passes.
+     */
+    template <typename Builder> static std::vector<UltraCircuitCheckFailure> check_report(const Builder& builder);
+
+    // Blocks are split into chunks of at least this many rows, which are checked in parallel
+    static constexpr size_t MIN_ROWS_PER_CHUNK = 1 << 8;
+
   private:
     struct TagCheckData;           // Container for data pertaining to generalized permutation tag check
     struct MemoryCheckData;        // Container for data pertaining to RAM/RAM record check
@@ -48,21 +107,44 @@ class UltraCircuitChecker {
     using LookupHashTable = std::unordered_set<Key, HashFunction>;
 
     /**
-     * @brief Checks that the provided witness satisfies all gates contained in a single execution trace block
+     * @brief Check all gates of the circuit, splitting each block into chunks of rows that are checked in parallel
+     * @details The lookup hash table and the memory record data are constructed once and shared read-only by all
+     * chunks. The tag check depends on the order in which variables are first encountered, so it is done in a single
+     * pass over the trace once all chunks are done.
+     *
+     * @tparam stop_at_first_failure Stop checking once a failure is found, and return only the first failure in (block,
+     * row) order, i.e. the one a sequential check would have found first
+     * @tparam Builder
+     * @param builder_in
+     */
+    template <bool stop_at_first_failure, typename Builder>
+    static std::vector<UltraCircuitCheckFailure> check_all(const Builder& builder_in);
+
+    /**
+     * @brief Checks that the provided witness satisfies the gates in rows [row_start, row_end) of an execution trace
+     * block
      *
      * @tparam Builder
      * @param builder
      * @param block
-     * @param tag_data
+     * @param block_idx
+     * @param row_start
+     * @param row_end
      * @param memory_data
      * @param lookup_hash_table
+     * @param failures Failures are appended here
+     * @param should_stop Called before each row; the check stops when it returns true
      */
-    template <typename Builder>
-    static bool check_block(Builder& builder,
+    template <typename Builder, typename ShouldStop>
+    static void check_block(Builder& builder,
                             auto& block,
-                            TagCheckData& tag_data,
-                            MemoryCheckData& memory_data,
-                            LookupHashTable& lookup_hash_table);
+                            size_t block_idx,
+                            size_t row_start,
+                            size_t row_end,
+                            const MemoryCheckData& memory_data,
+                            const LookupHashTable& lookup_hash_table,
+                            std::vector<UltraCircuitCheckFailure>& failures,
+                            const ShouldStop& should_stop);
 
     /**
      * @brief Check that a given relation is satisfied for the provided inputs corresponding to a single row
@@ -72,8 +154,9 @@ class UltraCircuitChecker {
      * @tparam Relation
      * @param values Values of the relation inputs at a single row
      * @param params
+     * @param report Called with the index of each subrelation that does not hold
      */
-    template <typename Relation> static bool check_relation(auto& values, auto& params);
+    template <typename Relation> static bool check_relation(auto& values, auto& params, const auto& report);
 
     /**
      * @brief Check whether the values in a lookup gate are contained within a corresponding hash table
@@ -92,12 +175,15 @@ class UltraCircuitChecker {
     template <typename Builder> static bool check_databus_read(auto& values, Builder& builder);
 
     /**
-     * @brief Check whether the left and right running tag products are equal
-     * @note By construction, this is in general only true after the last gate has been processed
+     * @brief Check that the running tag products over the variables of the whole trace are equal
+     * @details Each tagged variable is included once, with the value it has in the first cell of the trace (in block,
+     * row, wire order) that contains it.
      *
-     * @param tag_data
+     * @tparam Builder
+     * @param builder
+     * @param memory_data
      */
-    static bool check_tag_data(const TagCheckData& tag_data);
+    template <typename Builder> static bool check_tags(Builder& builder, const MemoryCheckData& memory_data);
 
     /**
      * @brief Helper for initializing an empty AllValues container of the right Flavor based on Builder
@@ -111,18 +197,30 @@ class UltraCircuitChecker {
 
     /**
      * @brief Populate the values required to check the correctness of a single "row" of the circuit
-     * @details Populates all wire values (plus shifts) and selectors. Updates running tag product information.
-     * Populates 4th wire with memory records (as needed).
+     * @details Populates all wire values (plus shifts) and selectors. Populates 4th wire with memory records (as
+     * needed).
      *
      * @tparam Builder
      * @param builder
      * @param values
-     * @param tag_data
+     * @param memory_data
      * @param idx
      */
     template <typename Builder>
     static void populate_values(
-        Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx);
+        Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx);
+
+    /**
+     * @brief The value of the 4th wire at a given row of a block, which is a memory record on RAM/ROM read/write gates
+     *
+     * @tparam Builder
+     * @param builder
+     * @param block
+     * @param memory_data
+     * @param idx
+     */
+    template <typename Builder>
+    static FF get_w_4(Builder& builder, auto& block, const MemoryCheckData& memory_data, size_t idx);
 
     /**
      * @brief Struct for managing the running tag product data for ensuring tag correctness
@@ -132,8 +230,12 @@ class UltraCircuitChecker {
         FF right_product = FF::one();          // product of (value + γ ⋅ tau[tag])
         const FF gamma = FF::random_element(); // randomness for the tag check
 
-        // We need to include each variable only once
-        std::unordered_set<size_t> encountered_variables;
+        // We need to include each (real) variable only once
+        std::vector<bool> encountered_variables;
+
+        TagCheckData(size_t num_variables)
+            : encountered_variables(num_variables, false)
+        {}
     };
 
     /**
@@ -1,4 +1,6 @@
 #include "barretenberg/client_ivc/client_ivc.hpp"
+#include "barretenberg/common/work_stealing.hpp"
+#include "barretenberg/ultra_honk/verification_key_cache.hpp"
 
 namespace bb {
 
@@ -13,6 +15,68 @@ namespace bb {
  * @param precomputed_vk Optional precomputed VK (otherwise will be computed herein)
  */
 void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
+    construct_instance(circuit);
+    fold_instance(precomputed_vk);
+}
+
+/**
+ * @brief Accumulate a sequence of circuits into the IVC scheme, constructing each circuit while the previous one is
+ * being folded
+ * @details Accumulating a circuit consists of completing it with the recursive folding and merge verifiers of the
+ * previous step, constructing its prover instance, and folding it. The first two cannot start before the previous fold
+ * proof exists, but constructing the circuit itself (i.e. witness generation for its application logic) can, so it is
+ * run as a task alongside the folding of the previous circuit, which leaves the critical path with the recursive
+ * verifiers, the instance construction and the folding. Both tasks use the shared work-stealing pool, so the threads
+ * the folding prover leaves idle (e.g. in its sequential phases) construct the next circuit.
+ *
+ * The result is identical to calling accumulate on each circuit in turn.
+ *
+ * @param circuits The circuits to be accumulated, in order, each with an optional precomputed VK
+ */
+void ClientIVC::accumulate_pipelined(const std::vector<PipelinedCircuit>& circuits)
+{
+    if (circuits.empty()) {
+        return;
+    }
+
+    auto circuit = std::make_unique<ClientCircuit>(circuits[0].construct());
+    for (size_t idx = 0; idx < circuits.size(); ++idx) {
+        // A circuit built on its own op queue is placed after the ops of the circuits accumulated so far
+        const bool has_own_op_queue = circuit->op_queue != goblin.op_queue;
+        if (has_own_op_queue) {
+            circuit->op_queue->prepend_previous_queue(*goblin.op_queue);
+        }
+        construct_instance(*circuit);
+        if (has_own_op_queue) {
+            std::swap(*goblin.op_queue, *circuit->op_queue);
+        }
+        // The instance holds everything needed from the circuit
+        circuit.reset();
+
+        std::unique_ptr<ClientCircuit> next_circuit;
+        TaskGroup group;
+        group.run([&] { fold_instance(circuits[idx].precomputed_vk); });
+        if (idx + 1 < circuits.size()) {
+            group.run([&] {
+                BB_OP_COUNT_TIME_NAME("construct_circuits");
+                next_circuit = std::make_unique<ClientCircuit>(circuits[idx + 1].construct());
+            });
+        }
+        group.wait();
+        circuit = std::move(next_circuit);
+    }
+}
+
+/**
+ * @brief Complete a circuit with the recursive verifiers of the previous accumulation step and construct its prover
+ * instance
+ * @details If a previous fold proof exists, a recursive folding verifier is appended to the circuit. A merge proof is
+ * then constructed (after appending a recursive merge verifier if a previous merge proof exists).
+ *
+ * @param circuit Circuit to be accumulated/folded
+ */
+void ClientIVC::construct_instance(ClientCircuit& circuit)
 {
     // If a previous fold proof exists, add a recursive folding verification to the circuit
     if (!fold_output.proof.empty()) {
@@ -27,12 +91,22 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
 
     // Construct the prover instance for circuit
     prover_instance = std::make_shared<ProverInstance>(circuit, structured_flag);
+}
 
+/**
+ * @brief Set the verification key of the instance constructed by construct_instance and fold the instance into the
+ * accumulator (or initialize the accumulators with it if the IVC is uninitialized)
+ *
+ * @param precomputed_vk Optional precomputed VK (otherwise will be computed herein, through the verification key cache
+ * if it is enabled)
+ */
+void ClientIVC::fold_instance(const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
     // Set the instance verification key from precomputed if available, else compute it
     if (precomputed_vk) {
         instance_vk = precomputed_vk;
     } else {
-        instance_vk = std::make_shared<VerificationKey>(prover_instance->proving_key);
+        instance_vk = compute_verification_key<Flavor>(prover_instance->proving_key);
     }
 
     // If the IVC is uninitialized, simply initialize the prover and verifier accumulator instances
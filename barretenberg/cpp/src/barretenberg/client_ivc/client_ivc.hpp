@@ -60,6 +60,17 @@ class ClientIVC {
         }
     };
 
+    /**
+     * @brief A circuit to be accumulated by accumulate_pipelined, described by a function that constructs it
+     * @details The function may run on a worker thread while the previous circuit is being folded, so it must not
+     * depend on the state of the IVC. In particular the circuit should be built on an op queue of its own (the default
+     * for a ClientCircuit), which is prepended with the IVC's op queue before the circuit is accumulated.
+     */
+    struct PipelinedCircuit {
+        std::function<ClientCircuit()> construct;
+        std::shared_ptr<VerificationKey> precomputed_vk = nullptr;
+    };
+
   private:
     using ProverFoldOutput = FoldingResult<Flavor>;
     // Note: We need to save the last instance that was folded in order to compute its verification key, this will not
@@ -83,6 +94,8 @@ class ClientIVC {
 
     void accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk = nullptr);
 
+    void accumulate_pipelined(const std::vector<PipelinedCircuit>& circuits);
+
     Proof prove();
 
     bool verify(Proof& proof, const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances);
@@ -90,5 +103,10 @@ class ClientIVC {
     HonkProof decider_prove() const;
 
     std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(std::vector<ClientCircuit>);
+
+  private:
+    void construct_instance(ClientCircuit& circuit);
+
+    void fold_instance(const std::shared_ptr<VerificationKey>& precomputed_vk);
 };
 } // namespace bb
\ No newline at end of file
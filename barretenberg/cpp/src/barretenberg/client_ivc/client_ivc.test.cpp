@@ -212,3 +212,28 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
 
     EXPECT_TRUE(prove_and_verify(ivc));
 };
+
+/**
+ * @brief Prove and verify accumulation of circuits constructed concurrently with the folding of their predecessors
+ *
+ */
+TEST_F(ClientIVCTests, PipelinedAccumulation)
+{
+    ClientIVC ivc;
+
+    // Each circuit is built on an op queue of its own, as it may be constructed while the previous one is folded
+    size_t NUM_CIRCUITS = 3;
+    std::vector<ClientIVC::PipelinedCircuit> circuits;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        circuits.push_back({ .construct = [] {
+            Builder circuit;
+            MockCircuits::construct_arithmetic_circuit(circuit, /*log2_num_gates=*/15);
+            MockCircuits::construct_goblin_ecc_op_circuit(circuit);
+            return circuit;
+        } });
+    }
+
+    ivc.accumulate_pipelined(circuits);
+
+    EXPECT_TRUE(prove_and_verify(ivc));
+};
@@ -25,7 +25,53 @@ template <typename Curve> void bench_commit(::benchmark::State& state)
     }
 }
 
+// A polynomial shaped like a selector or range constrained wire: mostly zeros, some ones and short values and a few
+// random field elements
+template <typename Curve> Polynomial<typename Curve::ScalarField> sparse_polynomial(const size_t num_points)
+{
+    using Fr = typename Curve::ScalarField;
+    auto polynomial = Polynomial<Fr>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (i % 16) {
+        case 0:
+            polynomial[i] = Fr::one();
+            break;
+        case 1:
+            polynomial[i] = Fr(i & 0x3fffU);
+            break;
+        case 2:
+            polynomial[i] = Fr::random_element();
+            break;
+        default:
+            break;
+        }
+    }
+    return polynomial;
+}
+
+template <typename Curve> void bench_commit_sparse_polynomial(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = sparse_polynomial<Curve>(num_points);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit(polynomial));
+    }
+}
+
+template <typename Curve> void bench_commit_sparse(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = sparse_polynomial<Curve>(num_points);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit_sparse(polynomial));
+    }
+}
+
 BENCHMARK(bench_commit<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_polynomial<curve::BN254>)
+    ->DenseRange(10, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
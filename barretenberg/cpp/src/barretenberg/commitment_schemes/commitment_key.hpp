@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -75,6 +76,82 @@ template <class Curve> class CommitmentKey {
         return scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
+
+    /**
+     * @brief Efficiently commit to a polynomial whose coefficients are mostly zero or small
+     * @details Zero coefficients are skipped, coefficients equal to one or below 2^SHORT_SCALAR_BITS use cheap
+     * addition-only paths and only the remaining coefficients go through the full pippenger (see
+     * `pippenger_unsafe_sparse`). The result is the same as `commit`.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_sparse(std::span<const Fr> polynomial)
+    {
+        BB_OP_COUNT_TIME();
+        const size_t degree = polynomial.size();
+        ASSERT(degree <= srs->get_monomial_size());
+        return scalar_multiplication::pippenger_unsafe_sparse<Curve>(
+            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Commit to several polynomials at once
+     *
+     * @details Small and medium sized polynomials are committed to in groups using a single batched pippenger, which
+     * shares the wnaf computation, the bucket sort and the thread fan-out of each round between all the MSMs of the
+     * group. A group is closed once its total size reaches MAX_BATCH_POINTS, so the batched point schedule never
+     * needs more memory than a single MSM of that size; polynomials that are larger than that on their own are
+     * committed to individually.
+     *
+     * @param polynomials univariate polynomials, each no larger than the SRS
+     * @return Commitments to `polynomials`, in the same order
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        // The radix sort of the batched point schedule must not reach the sign bit of its entries, see
+        // `pippenger_unsafe_batch`.
+        constexpr size_t MAX_SORT_BITS = 24;
+        constexpr size_t MAX_BATCH_POINTS = 1UL << 20;
+
+        std::vector<Commitment> commitments(polynomials.size());
+        auto commit_group = [&](size_t start, size_t end) {
+            if (end - start == 1) {
+                commitments[start] = commit(polynomials[start]);
+                return;
+            }
+            auto results = scalar_multiplication::pippenger_unsafe_batch<Curve>(polynomials.subspan(start, end - start),
+                                                                                srs->get_monomial_points());
+            for (size_t i = start; i < end; ++i) {
+                commitments[i] = results[i - start];
+            }
+        };
+
+        size_t group_start = 0;
+        size_t group_points = 0;
+        size_t group_max_degree = 0;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const size_t degree = polynomials[i].size();
+            ASSERT(degree <= srs->get_monomial_size());
+            const size_t max_degree = std::max(group_max_degree, degree);
+            const size_t num_msms = i - group_start + 1;
+            const size_t sort_bits = scalar_multiplication::get_optimal_bucket_width(max_degree) +
+                                     static_cast<size_t>(numeric::get_msb(2 * num_msms - 1)) + 1;
+            if (i > group_start && (group_points + degree > MAX_BATCH_POINTS || sort_bits > MAX_SORT_BITS)) {
+                commit_group(group_start, i);
+                group_start = i;
+                group_points = 0;
+                group_max_degree = 0;
+            }
+            group_points += degree;
+            group_max_degree = std::max(group_max_degree, degree);
+        }
+        if (group_start < polynomials.size()) {
+            commit_group(group_start, polynomials.size());
+        }
+        return commitments;
+    };
 };
 
 } // namespace bb
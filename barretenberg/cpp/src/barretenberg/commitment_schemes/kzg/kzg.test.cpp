@@ -49,6 +49,26 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(this->vk()->pairing_check(pairing_points[0], pairing_points[1]), true);
 }
 
+TYPED_TEST(KZGTest, BatchCommit)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Commitment = typename TypeParam::AffineElement;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    std::vector<Polynomial> polynomials;
+    for (const size_t n : { 1, 16, 1024, 4, 512 }) {
+        polynomials.emplace_back(this->random_polynomial(n));
+    }
+
+    std::vector<std::span<const Fr>> polynomial_spans(polynomials.begin(), polynomials.end());
+    std::vector<Commitment> commitments = this->ck()->batch_commit(polynomial_spans);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(commitments[i], this->commit(polynomials[i]));
+    }
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
@@ -4,6 +4,7 @@
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -112,6 +113,61 @@ template <typename PCS> class ZeroMorphProver_ {
         return quotients;
     }
 
+    /**
+     * @brief Compute the multivariate quotients q_k of f in place, in the memory of f
+     * @details Runs the same recursion as compute_multilinear_quotients without allocating the quotients or copying f.
+     * The step computing q_k reads f[0, 2^{k+1}): it writes q_k[l] = f[2^k + l] - f[l] over the upper half, which is
+     * no longer needed, and updates the lower half to f[l] + u_k * q_k[l]. Once done, q_k is stored at [2^k, 2^{k+1})
+     * (see get_quotient) and polynomial[0] = f(u).
+     *
+     * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1}); overwritten by the quotients
+     * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
+     */
+    static void compute_multilinear_quotients_in_place(Polynomial& polynomial, std::span<const FF> u_challenge)
+    {
+        const size_t log_N = numeric::get_msb(polynomial.size());
+        // The size of the multilinear challenge must equal the log of the polynomial size
+        ASSERT(log_N == u_challenge.size());
+
+        for (size_t k = log_N; k-- > 0;) {
+            const size_t size_q = size_t(1) << k;
+            const FF u_k = u_challenge[k];
+            run_loop_in_parallel_if_effective(
+                size_q,
+                [&](size_t start, size_t end) {
+                    for (size_t l = start; l < end; ++l) {
+                        const FF q = polynomial[size_q + l] - polynomial[l];
+                        polynomial[size_q + l] = q;
+                        polynomial[l] += u_k * q;
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/2,
+                /*finite_field_multiplications_per_iteration=*/1);
+        }
+    }
+
+    /**
+     * @brief The quotient q_k within the output of compute_multilinear_quotients_in_place
+     */
+    static std::span<const FF> get_quotient(const Polynomial& quotients, size_t k)
+    {
+        const size_t size = size_t(1) << k;
+        return { quotients.begin() + size, size };
+    }
+
+    /**
+     * @brief All the quotients q_0, ..., q_{log_N - 1} within the output of compute_multilinear_quotients_in_place
+     */
+    static std::vector<std::span<const FF>> get_quotients(const Polynomial& quotients, size_t log_N)
+    {
+        std::vector<std::span<const FF>> result;
+        result.reserve(log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            result.emplace_back(get_quotient(quotients, k));
+        }
+        return result;
+    }
+
     /**
      * @brief Construct batched, lifted-degree univariate quotient \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
      * @details The purpose of the batched lifted-degree quotient is to reduce the individual degree checks
@@ -124,7 +180,7 @@ template <typename PCS> class ZeroMorphProver_ {
      * @param N circuit size
      * @return Polynomial
      */
-    static Polynomial compute_batched_lifted_degree_quotient(std::vector<Polynomial>& quotients,
+    static Polynomial compute_batched_lifted_degree_quotient(const std::vector<std::span<const FF>>& quotients,
                                                              FF y_challenge,
                                                              size_t N)
     {
@@ -134,7 +190,7 @@ template <typename PCS> class ZeroMorphProver_ {
         // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
         size_t k = 0;
         auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
+        for (const auto& quotient : quotients) {
             // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
             // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
             auto deg_k = static_cast<size_t>((1 << k) - 1);
@@ -155,35 +211,50 @@ template <typename PCS> class ZeroMorphProver_ {
      *
      *                          \zeta_x = q - \sum_k y^k * x^{N - d_k - 1} * q_k
      *
-     * @param batched_quotient
+     * @param batched_quotient \hat{q}; the prover moves it in so that \zeta_x is computed in its memory
      * @param quotients
      * @param y_challenge
      * @param x_challenge
      * @return Polynomial Degree check polynomial \zeta_x such that \zeta_x(x) = 0
      */
-    static Polynomial compute_partially_evaluated_degree_check_polynomial(Polynomial& batched_quotient,
-                                                                          std::vector<Polynomial>& quotients,
-                                                                          FF y_challenge,
-                                                                          FF x_challenge)
+    static Polynomial compute_partially_evaluated_degree_check_polynomial(
+        Polynomial batched_quotient,
+        const std::vector<std::span<const FF>>& quotients,
+        FF y_challenge,
+        FF x_challenge)
     {
         size_t N = batched_quotient.size();
         size_t log_N = quotients.size();
 
         // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
+        auto result = std::move(batched_quotient);
+
+        // Accumulate -y^k * x^{N - d_k - 1} * q_k into \hat{q}
+        auto scalars = compute_degree_check_quotient_scalars(y_challenge, x_challenge, N, log_N);
+        for (size_t k = 0; k < log_N; ++k) {
+            result.add_scaled(quotients[k], scalars[k]);
+        }
 
+        return result;
+    }
+
+    /**
+     * @brief Compute the scalars -y^k * x^{N - d_k - 1} of the quotients q_k in \zeta_x
+     */
+    static std::vector<FF> compute_degree_check_quotient_scalars(FF y_challenge, FF x_challenge, size_t N, size_t log_N)
+    {
+        std::vector<FF> scalars;
+        scalars.reserve(log_N);
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
-            // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
 
-            result.add_scaled(quotients[k], -y_power * x_power);
+            scalars.emplace_back(-y_power * x_power);
 
             y_power *= y_challenge; // update batching scalar y^k
         }
-
-        return result;
+        return scalars;
     }
 
     /**
@@ -200,26 +271,27 @@ template <typename PCS> class ZeroMorphProver_ {
      *
      * @note The concatenation term arises from an implementation detail in the Translator and is not part of the
      * conventional ZM protocol
-     * @param input_polynomial
+     * @param f_batched
+     * @param g_batched The prover moves it in so that Z_x is computed in its memory
      * @param quotients
      * @param v_evaluation
      * @param x_challenge
      * @return Polynomial
      */
     static Polynomial compute_partially_evaluated_zeromorph_identity_polynomial(
-        Polynomial& f_batched,
-        Polynomial& g_batched,
-        std::vector<Polynomial>& quotients,
+        const Polynomial& f_batched,
+        Polynomial g_batched,
+        const std::vector<std::span<const FF>>& quotients,
         FF v_evaluation,
         std::span<const FF> u_challenge,
         FF x_challenge,
-        std::vector<Polynomial> concatenation_groups_batched = {})
+        const std::vector<Polynomial>& concatenation_groups_batched = {})
     {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
         // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
+        auto result = std::move(g_batched);
         result.add_scaled(f_batched, x_challenge);
 
         // Compute Z_x -= v * x * \Phi_n(x)
@@ -228,23 +300,9 @@ template <typename PCS> class ZeroMorphProver_ {
         result[0] -= v_evaluation * x_challenge * phi_n_x;
 
         // Add contribution from q_k polynomials
-        auto x_power = x_challenge; // x^{2^k}
+        auto scalars = compute_zeromorph_identity_quotient_scalars(u_challenge, x_challenge, N, log_N);
         for (size_t k = 0; k < log_N; ++k) {
-            x_power = x_challenge.pow(1 << k); // x^{2^k}
-
-            // \Phi_{n-k-1}(x^{2^{k + 1}})
-            auto phi_term_1 = phi_numerator / (x_challenge.pow(1 << (k + 1)) - 1);
-
-            // \Phi_{n-k}(x^{2^k})
-            auto phi_term_2 = phi_numerator / (x_challenge.pow(1 << k) - 1);
-
-            // x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k *  \Phi_{n-k}(x^{2^k})
-            auto scalar = x_power * phi_term_1 - u_challenge[k] * phi_term_2;
-
-            scalar *= x_challenge;
-            scalar *= FF(-1);
-
-            result.add_scaled(quotients[k], scalar);
+            result.add_scaled(quotients[k], scalars[k]);
         }
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
@@ -265,6 +323,40 @@ template <typename PCS> class ZeroMorphProver_ {
         return result;
     }
 
+    /**
+     * @brief Compute the scalars -x * (x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k * \Phi_{n-k}(x^{2^k})) of the quotients q_k
+     * in Z_x
+     */
+    static std::vector<FF> compute_zeromorph_identity_quotient_scalars(std::span<const FF> u_challenge,
+                                                                       FF x_challenge,
+                                                                       size_t N,
+                                                                       size_t log_N)
+    {
+        auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
+
+        std::vector<FF> scalars;
+        scalars.reserve(log_N);
+        auto x_power = x_challenge; // x^{2^k}
+        for (size_t k = 0; k < log_N; ++k) {
+            x_power = x_challenge.pow(1 << k); // x^{2^k}
+
+            // \Phi_{n-k-1}(x^{2^{k + 1}})
+            auto phi_term_1 = phi_numerator / (x_challenge.pow(1 << (k + 1)) - 1);
+
+            // \Phi_{n-k}(x^{2^k})
+            auto phi_term_2 = phi_numerator / (x_challenge.pow(1 << k) - 1);
+
+            // x^{2^k} * \Phi_{n-k-1}(x^{2^{k+1}}) - u_k *  \Phi_{n-k}(x^{2^k})
+            auto scalar = x_power * phi_term_1 - u_challenge[k] * phi_term_2;
+
+            scalar *= x_challenge;
+            scalar *= FF(-1);
+
+            scalars.emplace_back(scalar);
+        }
+        return scalars;
+    }
+
     /**
      * @brief Compute combined evaluation and degree-check polynomial pi
      * @details Compute univariate polynomial pi, where
@@ -275,15 +367,13 @@ template <typename PCS> class ZeroMorphProver_ {
      * opening. If this is instantiated with KZG, the PCS is going to compute the quotient
      * q_pi = (q_\zeta + z*q_Z)X^{N_{max}-(N-1)}, with q_\zeta = \zeta_x/(X-x), q_Z = Z_x/(X-x),
      *
+     * @param zeta_x The prover moves it in so that pi is computed in its memory
      * @param Z_x
-     * @param zeta_x
-     * @param x_challenge
      * @param z_challenge
-     * @param N_max
      * @return Polynomial
      */
-    static Polynomial compute_batched_evaluation_and_degree_check_polynomial(Polynomial& zeta_x,
-                                                                             Polynomial& Z_x,
+    static Polynomial compute_batched_evaluation_and_degree_check_polynomial(Polynomial zeta_x,
+                                                                             const Polynomial& Z_x,
                                                                              FF z_challenge)
     {
         // We cannot commit to polynomials with size > N_max
@@ -291,7 +381,7 @@ template <typename PCS> class ZeroMorphProver_ {
         ASSERT(N <= N_max);
 
         // Compute batched polynomial zeta_x + Z_x
-        auto batched_polynomial = zeta_x;
+        auto batched_polynomial = std::move(zeta_x);
         batched_polynomial.add_scaled(Z_x, z_challenge);
 
         // TODO(#742): To complete the degree check, we need to do an opening proof for x_challenge with a univariate
@@ -360,10 +450,14 @@ template <typename PCS> class ZeroMorphProver_ {
             batching_scalar *= rho;
         };
 
+        // Compute the full batched polynomial f = f_batched + g_batched.shifted() + concatenated_batched = f_batched +
+        // h_batched + concatenated_batched. This is the polynomial for which we compute the quotients q_k and prove
+        // f(u) = v_batched.
+        Polynomial f_polynomial = f_batched;
+        f_polynomial += g_batched.shifted();
+
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
-        // Concatenated polynomials
-        Polynomial concatenated_batched(N);
 
         // construct concatention_groups_batched
         std::vector<Polynomial> concatenation_groups_batched;
@@ -372,7 +466,7 @@ template <typename PCS> class ZeroMorphProver_ {
         }
         // for each group
         for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
+            f_polynomial.add_scaled(concatenated_polynomials[i], batching_scalar);
             // for each element in a group
             for (size_t j = 0; j < num_chunks_per_group; ++j) {
                 concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
@@ -381,28 +475,22 @@ template <typename PCS> class ZeroMorphProver_ {
             batching_scalar *= rho;
         }
 
-        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
-        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
-
-        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1}). They are computed in place of f, which is
+        // not needed afterwards, so that they take no memory of their own.
+        compute_multilinear_quotients_in_place(f_polynomial, u_challenge);
+        const auto quotients = get_quotients(f_polynomial, log_N);
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
+            Commitment q_k_commitment = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
-            transcript->send_to_verifier(label, q_k_commitments[idx]);
+            transcript->send_to_verifier(label, q_k_commitment);
         }
 
         // Get challenge y
         FF y_challenge = transcript->template get_challenge<FF>("ZM:y");
 
-        // Compute the batched, lifted-degree quotient \hat{q}
+        // Compute the batched, lifted-degree quotient \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
         auto batched_quotient = compute_batched_lifted_degree_quotient(quotients, y_challenge, N);
 
         // Compute and send the commitment C_q = [\hat{q}]
@@ -412,21 +500,23 @@ template <typename PCS> class ZeroMorphProver_ {
         // Get challenges x and z
         auto [x_challenge, z_challenge] = transcript->template get_challenges<FF>("ZM:x", "ZM:z");
 
-        // Compute degree check polynomial \zeta partially evaluated at x
-        auto zeta_x =
-            compute_partially_evaluated_degree_check_polynomial(batched_quotient, quotients, y_challenge, x_challenge);
+        // Compute degree check polynomial \zeta partially evaluated at x, in place of \hat{q}
+        auto zeta_x = compute_partially_evaluated_degree_check_polynomial(
+            std::move(batched_quotient), quotients, y_challenge, x_challenge);
 
-        // Compute ZeroMorph identity polynomial Z partially evaluated at x
+        // Compute ZeroMorph identity polynomial Z partially evaluated at x, in place of g_batched
         auto Z_x = compute_partially_evaluated_zeromorph_identity_polynomial(f_batched,
-                                                                             g_batched,
+                                                                             std::move(g_batched),
                                                                              quotients,
                                                                              batched_evaluation,
                                                                              u_challenge,
                                                                              x_challenge,
                                                                              concatenation_groups_batched);
 
-        // Compute batched degree-check and ZM-identity quotient polynomial pi
-        auto pi_polynomial = compute_batched_evaluation_and_degree_check_polynomial(zeta_x, Z_x, z_challenge);
+        // Compute batched degree-check and ZM-identity quotient polynomial pi, in place of \zeta_x
+        auto pi_polynomial =
+            compute_batched_evaluation_and_degree_check_polynomial(std::move(zeta_x), Z_x, z_challenge);
+
         // Compute opening proof for x_challenge using the underlying univariate PCS
         PCS::compute_opening_proof(
             commitment_key, { .challenge = x_challenge, .evaluation = FF(0) }, pi_polynomial, transcript);
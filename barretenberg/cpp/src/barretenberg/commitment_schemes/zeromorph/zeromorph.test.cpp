@@ -348,6 +348,36 @@ TYPED_TEST(ZeroMorphTest, QuotientConstruction)
     EXPECT_EQ(result, 0);
 }
 
+/**
+ * @brief Test that computing the quotients q_k in place of f gives the same quotients as
+ * compute_multilinear_quotients, and leaves f(u) in place of the constant coefficient of f
+ *
+ */
+TYPED_TEST(ZeroMorphTest, QuotientConstructionInPlace)
+{
+    using ZeroMorphProver = ZeroMorphProver_<TypeParam>;
+    using Curve = typename TypeParam::Curve;
+    using Fr = typename Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    size_t N = 1 << 10;
+    size_t log_N = numeric::get_msb(N);
+
+    Polynomial multilinear_f = this->random_polynomial(N);
+    std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
+    Fr v_evaluation = multilinear_f.evaluate_mle(u_challenge);
+
+    std::vector<Polynomial> expected_quotients =
+        ZeroMorphProver::compute_multilinear_quotients(multilinear_f, u_challenge);
+
+    ZeroMorphProver::compute_multilinear_quotients_in_place(multilinear_f, u_challenge);
+    for (size_t k = 0; k < log_N; ++k) {
+        auto quotient = ZeroMorphProver::get_quotient(multilinear_f, k);
+        EXPECT_EQ(Polynomial(quotient), expected_quotients[k]);
+    }
+    EXPECT_EQ(multilinear_f[0], v_evaluation);
+}
+
 /**
  * @brief Test function for constructing batched lifted degree quotient \hat{q}
  *
@@ -369,7 +399,7 @@ TYPED_TEST(ZeroMorphTest, BatchedLiftedDegreeQuotient)
     Polynomial q_0(data_0);
     Polynomial q_1(data_1);
     Polynomial q_2(data_2);
-    std::vector<Polynomial> quotients = { q_0, q_1, q_2 };
+    std::vector<std::span<const Fr>> quotients = { q_0, q_1, q_2 };
 
     auto y_challenge = Fr::random_element();
 
@@ -414,7 +444,7 @@ TYPED_TEST(ZeroMorphTest, PartiallyEvaluatedQuotientZeta)
     Polynomial q_0(data_0);
     Polynomial q_1(data_1);
     Polynomial q_2(data_2);
-    std::vector<Polynomial> quotients = { q_0, q_1, q_2 };
+    std::vector<std::span<const Fr>> quotients = { q_0, q_1, q_2 };
 
     auto y_challenge = Fr::random_element();
 
@@ -512,7 +542,7 @@ TYPED_TEST(ZeroMorphTest, PartiallyEvaluatedQuotientZ)
     auto q_0 = this->random_polynomial(1 << 0);
     auto q_1 = this->random_polynomial(1 << 1);
     auto q_2 = this->random_polynomial(1 << 2);
-    std::vector<Polynomial> quotients = { q_0, q_1, q_2 };
+    std::vector<std::span<const Fr>> quotients = { q_0, q_1, q_2 };
 
     auto x_challenge = Fr::random_element();
 
@@ -2,6 +2,8 @@
 #include <cstddef>
 #ifdef BB_USE_OP_COUNT
 #include "op_count.hpp"
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <thread>
@@ -70,6 +72,100 @@ void GlobalOpCountContainer::clear()
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 GlobalOpCountContainer GLOBAL_OP_COUNTS;
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::shared_ptr<ThreadTraceBuffer> GlobalTraceContainer::thread_buffer;
+
+ThreadTraceBuffer& GlobalTraceContainer::get_thread_buffer()
+{
+    if (BB_UNLIKELY(thread_buffer == nullptr)) {
+        std::stringstream ss;
+        ss << std::this_thread::get_id();
+        std::unique_lock<std::mutex> lock(mutex);
+        // The container shares ownership so that the spans outlive the thread that recorded them
+        thread_buffer = std::make_shared<ThreadTraceBuffer>(buffers.size(), ss.str());
+        buffers.push_back(thread_buffer);
+    }
+    return *thread_buffer;
+}
+
+void GlobalTraceContainer::clear()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto& buffer : buffers) {
+        buffer->num_recorded.store(0, std::memory_order_relaxed);
+    }
+}
+
+namespace {
+void write_json_string(std::ostream& os, const std::string& str)
+{
+    os << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\';
+        }
+        os << c;
+    }
+    os << '"';
+}
+} // namespace
+
+void GlobalTraceContainer::write_chrome_trace(std::ostream& os) const
+{
+    // Chrome trace timestamps are in microseconds; we make them relative to the first span
+    std::size_t first_start = SIZE_MAX;
+    std::size_t num_dropped = 0;
+    for (const auto& buffer : buffers) {
+        const std::size_t num_recorded = buffer->num_recorded.load(std::memory_order_acquire);
+        const std::size_t num_kept = std::min(num_recorded, ThreadTraceBuffer::CAPACITY);
+        num_dropped += num_recorded - num_kept;
+        for (std::size_t i = 0; i < num_kept; ++i) {
+            first_start = std::min(first_start, buffer->events[i].start);
+        }
+    }
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first_event = true;
+    auto separate = [&]() {
+        if (!first_event) {
+            os << ",";
+        }
+        first_event = false;
+        os << "\n";
+    };
+    for (const auto& buffer : buffers) {
+        const std::size_t num_recorded = buffer->num_recorded.load(std::memory_order_acquire);
+        const std::size_t num_kept = std::min(num_recorded, ThreadTraceBuffer::CAPACITY);
+        if (num_kept == 0) {
+            continue;
+        }
+        separate();
+        os << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->thread_index
+           << ",\"args\":{\"name\":";
+        write_json_string(os, "thread " + buffer->thread_id);
+        os << "}}";
+        // Oldest span first
+        for (std::size_t i = num_recorded - num_kept; i < num_recorded; ++i) {
+            const TraceEvent& event = buffer->events[i % ThreadTraceBuffer::CAPACITY];
+            separate();
+            os << "{\"ph\":\"X\",\"cat\":\"bb\",\"name\":";
+            write_json_string(os, event.name);
+            os << ",\"pid\":1,\"tid\":" << buffer->thread_index
+               << ",\"ts\":" << static_cast<double>(event.start - first_start) / 1000.0
+               << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << ",\"args\":{\"depth\":" << event.depth
+               << "}}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_spans\":" << num_dropped << "}}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+GlobalTraceContainer GLOBAL_TRACE;
+
 OpCountCycleReporter::OpCountCycleReporter(OpStats* stats)
     : stats(stats)
 {
@@ -86,9 +182,14 @@ OpCountCycleReporter::~OpCountCycleReporter()
     stats->cycles += __builtin_ia32_rdtsc() - cycles;
 #endif
 }
-OpCountTimeReporter::OpCountTimeReporter(OpStats* stats)
+OpCountTimeReporter::OpCountTimeReporter(OpStats* stats, const char* name)
     : stats(stats)
+    , name(name)
 {
+    if (GLOBAL_TRACE.enabled.load(std::memory_order_relaxed)) {
+        trace_buffer = &GLOBAL_TRACE.get_thread_buffer();
+        trace_buffer->depth++;
+    }
     auto now = std::chrono::high_resolution_clock::now();
     auto now_ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
     time = static_cast<std::size_t>(now_ns.time_since_epoch().count());
@@ -97,8 +198,13 @@ OpCountTimeReporter::~OpCountTimeReporter()
 {
     auto now = std::chrono::high_resolution_clock::now();
     auto now_ns = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
+    const std::size_t duration = static_cast<std::size_t>(now_ns.time_since_epoch().count()) - time;
     stats->count += 1;
-    stats->time += static_cast<std::size_t>(now_ns.time_since_epoch().count()) - time;
+    stats->time += duration;
+    if (trace_buffer != nullptr) {
+        trace_buffer->depth--;
+        trace_buffer->record({ .name = name, .start = time, .duration = duration, .depth = trace_buffer->depth });
+    }
 }
 } // namespace bb::detail
 #endif
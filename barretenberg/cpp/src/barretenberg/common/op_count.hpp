@@ -28,6 +28,7 @@
 #include <cstdlib>
 #include <map>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <vector>
 namespace bb::detail {
@@ -73,11 +74,78 @@ struct GlobalOpCountContainer {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 extern GlobalOpCountContainer GLOBAL_OP_COUNTS;
 
+// A BB_OP_COUNT_TIME span that has completed, as recorded when tracing is enabled
+struct TraceEvent {
+    // Points to the static label of the GlobalOpCount that created the span
+    const char* name = nullptr;
+    // Nanoseconds since the clock's epoch
+    std::size_t start = 0;
+    std::size_t duration = 0;
+    // Number of spans of the same thread enclosing this one
+    std::size_t depth = 0;
+};
+
+/**
+ * @brief A ring buffer of the spans completed by one thread
+ * @details Only the owning thread writes to it, without locking; once full, the oldest spans are overwritten. It must
+ * only be read while the owning thread is not recording, e.g. after all parallel_for calls have returned.
+ */
+struct ThreadTraceBuffer {
+    static constexpr std::size_t CAPACITY = 1 << 16;
+
+    std::size_t thread_index;
+    std::string thread_id;
+    // Depth of the next span opened on this thread
+    std::size_t depth = 0;
+    std::atomic<std::size_t> num_recorded = 0;
+    std::vector<TraceEvent> events = std::vector<TraceEvent>(CAPACITY);
+
+    ThreadTraceBuffer(std::size_t thread_index, std::string thread_id)
+        : thread_index(thread_index)
+        , thread_id(std::move(thread_id))
+    {}
+
+    void record(const TraceEvent& event)
+    {
+        const std::size_t index = num_recorded.load(std::memory_order_relaxed);
+        events[index % CAPACITY] = event;
+        num_recorded.store(index + 1, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief Contains the span buffers of all threads that recorded spans while tracing was enabled
+ * @details Tracing is off by default, in which case BB_OP_COUNT_TIME only aggregates into GLOBAL_OP_COUNTS.
+ */
+struct GlobalTraceContainer {
+  public:
+    std::atomic<bool> enabled = false;
+    // Only guards the registration of new threads' buffers
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers;
+
+    // Returns the calling thread's buffer, registering it on first use
+    ThreadTraceBuffer& get_thread_buffer();
+    // NOTE: The functions below should be called when other threads aren't active
+    void clear();
+    // Writes the recorded spans in the Chrome trace event format, which Perfetto also loads
+    void write_chrome_trace(std::ostream& os) const;
+
+  private:
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local std::shared_ptr<ThreadTraceBuffer> thread_buffer;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern GlobalTraceContainer GLOBAL_TRACE;
+
 template <OperationLabel Op> struct GlobalOpCount {
   public:
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     static thread_local std::shared_ptr<OpStats> stats;
 
+    static constexpr const char* label() { return Op.value; }
+
     static OpStats* ensure_stats()
     {
         if (BB_UNLIKELY(stats == nullptr)) {
@@ -138,7 +206,10 @@ struct OpCountCycleReporter {
 struct OpCountTimeReporter {
     OpStats* stats;
     std::size_t time;
-    OpCountTimeReporter(OpStats* stats);
+    const char* name;
+    // Set if tracing was enabled when the span opened
+    ThreadTraceBuffer* trace_buffer = nullptr;
+    OpCountTimeReporter(OpStats* stats, const char* name);
     ~OpCountTimeReporter();
 };
 } // namespace bb::detail
@@ -154,7 +225,8 @@ struct OpCountTimeReporter {
 #define BB_OP_COUNT_CYCLES() BB_OP_COUNT_CYCLES_NAME(__func__)
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME_NAME(name)                                                                                    \
-    bb::detail::OpCountTimeReporter __bb_op_count_time(bb::detail::GlobalOpCount<name>::ensure_stats())
+    bb::detail::OpCountTimeReporter __bb_op_count_time(bb::detail::GlobalOpCount<name>::ensure_stats(),                \
+                                                       bb::detail::GlobalOpCount<name>::label())
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME() BB_OP_COUNT_TIME_NAME(__func__)
 #endif
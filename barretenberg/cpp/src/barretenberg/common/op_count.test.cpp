@@ -0,0 +1,281 @@
+#ifdef BB_USE_OP_COUNT
+#include "op_count.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using namespace bb::detail;
+
+namespace {
+
+// Just enough of a JSON parser to check the shape of the trace output
+struct JsonValue {
+    using Object = std::map<std::string, JsonValue>;
+    using Array = std::vector<JsonValue>;
+    std::variant<std::nullptr_t, bool, double, std::string, Array, Object> value;
+
+    const Object& object() const { return std::get<Object>(value); }
+    const Array& array() const { return std::get<Array>(value); }
+    const std::string& string() const { return std::get<std::string>(value); }
+    double number() const { return std::get<double>(value); }
+    const JsonValue& operator[](const std::string& key) const { return object().at(key); }
+};
+
+class JsonParser {
+  public:
+    explicit JsonParser(std::string text)
+        : text(std::move(text))
+    {}
+
+    JsonValue parse()
+    {
+        JsonValue value = parse_value();
+        skip_whitespace();
+        EXPECT_EQ(pos, text.size()) << "trailing characters";
+        return value;
+    }
+
+  private:
+    std::string text;
+    size_t pos = 0;
+
+    void skip_whitespace()
+    {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])) != 0) {
+            pos++;
+        }
+    }
+
+    void expect(char c)
+    {
+        skip_whitespace();
+        if (pos >= text.size() || text[pos] != c) {
+            throw std::runtime_error(std::string("expected '") + c + "' at " + std::to_string(pos));
+        }
+        pos++;
+    }
+
+    bool consume(char c)
+    {
+        skip_whitespace();
+        if (pos < text.size() && text[pos] == c) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    std::string parse_string()
+    {
+        expect('"');
+        std::string result;
+        while (pos < text.size() && text[pos] != '"') {
+            if (text[pos] == '\\') {
+                pos++;
+            }
+            result += text[pos++];
+        }
+        expect('"');
+        return result;
+    }
+
+    JsonValue parse_value()
+    {
+        skip_whitespace();
+        if (pos >= text.size()) {
+            throw std::runtime_error("unexpected end of input");
+        }
+        const char c = text[pos];
+        if (c == '{') {
+            pos++;
+            JsonValue::Object object;
+            if (!consume('}')) {
+                do {
+                    skip_whitespace();
+                    std::string key = parse_string();
+                    expect(':');
+                    object.emplace(std::move(key), parse_value());
+                } while (consume(','));
+                expect('}');
+            }
+            return { object };
+        }
+        if (c == '[') {
+            pos++;
+            JsonValue::Array array;
+            if (!consume(']')) {
+                do {
+                    array.push_back(parse_value());
+                } while (consume(','));
+                expect(']');
+            }
+            return { array };
+        }
+        if (c == '"') {
+            return { parse_string() };
+        }
+        for (const auto& [literal, value] : { std::pair<std::string, JsonValue>{ "true", { true } },
+                                              std::pair<std::string, JsonValue>{ "false", { false } },
+                                              std::pair<std::string, JsonValue>{ "null", { nullptr } } }) {
+            if (text.compare(pos, literal.size(), literal) == 0) {
+                pos += literal.size();
+                return value;
+            }
+        }
+        char* end = nullptr;
+        const double number = std::strtod(text.c_str() + pos, &end);
+        if (end == text.c_str() + pos) {
+            throw std::runtime_error("expected a value at " + std::to_string(pos));
+        }
+        pos = static_cast<size_t>(end - text.c_str());
+        return { number };
+    }
+};
+
+JsonValue write_and_parse_trace()
+{
+    std::stringstream ss;
+    GLOBAL_TRACE.write_chrome_trace(ss);
+    return JsonParser(ss.str()).parse();
+}
+
+// The complete ("X") events of the trace, by thread
+std::map<double, std::vector<JsonValue>> spans_by_thread(const JsonValue& trace)
+{
+    std::map<double, std::vector<JsonValue>> spans;
+    for (const auto& event : trace["traceEvents"].array()) {
+        if (event["ph"].string() == "X") {
+            spans[event["tid"].number()].push_back(event);
+        }
+    }
+    return spans;
+}
+
+void inner_span()
+{
+    BB_OP_COUNT_TIME_NAME("op_count_test_inner");
+}
+
+void outer_span()
+{
+    BB_OP_COUNT_TIME_NAME("op_count_test_outer");
+    inner_span();
+    inner_span();
+}
+
+// Records spans only while the test runs, so that the global state does not leak into other tests
+class OpCountTrace : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        GLOBAL_TRACE.clear();
+        GLOBAL_TRACE.enabled = true;
+    }
+    void TearDown() override
+    {
+        GLOBAL_TRACE.enabled = false;
+        GLOBAL_TRACE.clear();
+    }
+};
+
+} // namespace
+
+TEST_F(OpCountTrace, NestedSpansOnTwoThreads)
+{
+    constexpr size_t NUM_THREADS = 2;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back(outer_span);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    GLOBAL_TRACE.enabled = false;
+
+    const JsonValue trace = write_and_parse_trace();
+    EXPECT_EQ(trace["displayTimeUnit"].string(), "ms");
+    EXPECT_EQ(trace["otherData"]["dropped_spans"].number(), 0);
+
+    // One thread name per recording thread
+    size_t num_thread_names = 0;
+    for (const auto& event : trace["traceEvents"].array()) {
+        if (event["ph"].string() == "M") {
+            EXPECT_EQ(event["name"].string(), "thread_name");
+            EXPECT_EQ(event["args"]["name"].string().rfind("thread ", 0), 0);
+            num_thread_names++;
+        }
+    }
+    EXPECT_EQ(num_thread_names, NUM_THREADS);
+
+    const auto spans = spans_by_thread(trace);
+    ASSERT_EQ(spans.size(), NUM_THREADS);
+    for (const auto& [tid, thread_spans] : spans) {
+        // Spans are recorded as they complete, so the outer span comes after its two inner spans
+        ASSERT_EQ(thread_spans.size(), 3);
+        const JsonValue& outer = thread_spans[2];
+        EXPECT_EQ(outer["name"].string(), "op_count_test_outer");
+        EXPECT_EQ(outer["cat"].string(), "bb");
+        EXPECT_EQ(outer["pid"].number(), 1);
+        EXPECT_EQ(outer["args"]["depth"].number(), 0);
+        // Timestamps are in microseconds with nanosecond precision
+        constexpr double TOLERANCE = 0.001;
+        for (size_t i = 0; i < 2; ++i) {
+            const JsonValue& inner = thread_spans[i];
+            EXPECT_EQ(inner["name"].string(), "op_count_test_inner");
+            EXPECT_EQ(inner["args"]["depth"].number(), 1);
+            EXPECT_GE(inner["ts"].number() + TOLERANCE, outer["ts"].number());
+            EXPECT_LE(inner["ts"].number() + inner["dur"].number(),
+                      outer["ts"].number() + outer["dur"].number() + TOLERANCE);
+        }
+        EXPECT_LE(thread_spans[0]["ts"].number(), thread_spans[1]["ts"].number());
+    }
+}
+
+TEST_F(OpCountTrace, RingBufferWrapsAround)
+{
+    constexpr size_t NUM_EXTRA = 10;
+    std::thread thread([]() {
+        for (size_t i = 0; i < ThreadTraceBuffer::CAPACITY + NUM_EXTRA; ++i) {
+            inner_span();
+        }
+    });
+    thread.join();
+    GLOBAL_TRACE.enabled = false;
+
+    const JsonValue trace = write_and_parse_trace();
+    EXPECT_EQ(trace["otherData"]["dropped_spans"].number(), NUM_EXTRA);
+
+    const auto spans = spans_by_thread(trace);
+    ASSERT_EQ(spans.size(), 1);
+    const auto& thread_spans = spans.begin()->second;
+    ASSERT_EQ(thread_spans.size(), ThreadTraceBuffer::CAPACITY);
+    // The oldest spans were overwritten, and the kept ones are written oldest first
+    for (size_t i = 1; i < thread_spans.size(); ++i) {
+        EXPECT_LE(thread_spans[i - 1]["ts"].number(), thread_spans[i]["ts"].number());
+        EXPECT_EQ(thread_spans[i]["args"]["depth"].number(), 0);
+    }
+}
+
+TEST(OpCountTraceBuffer, RecordOverwritesOldest)
+{
+    ThreadTraceBuffer buffer(0, "test");
+    for (size_t i = 0; i < ThreadTraceBuffer::CAPACITY + 3; ++i) {
+        buffer.record({ .name = "span", .start = i, .duration = 1, .depth = 0 });
+    }
+    EXPECT_EQ(buffer.num_recorded.load(), ThreadTraceBuffer::CAPACITY + 3);
+    // The three newest spans took the slots of the three oldest
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(buffer.events[i].start, ThreadTraceBuffer::CAPACITY + i);
+    }
+    EXPECT_EQ(buffer.events[3].start, 3);
+}
+#endif
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include "work_stealing.hpp"
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: None of the pools above can run a parallel_for from within a parallel_for: the pools reuse their single
+ * job slot and break, or we serialise. We now default to "work_stealing" (see work_stealing.hpp), where a nested
+ * parallel_for forks onto the same workers and the waiting thread helps out instead of blocking. The other
+ * implementations can still be selected at runtime with set_parallel_for_backend, e.g. to benchmark them.
  */
 
 namespace bb {
@@ -69,6 +75,19 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+namespace {
+#ifndef NO_OMP_MULTITHREADING
+std::atomic<ParallelForBackend> parallel_for_backend = ParallelForBackend::OMP;
+#else
+std::atomic<ParallelForBackend> parallel_for_backend = ParallelForBackend::WORK_STEALING;
+#endif
+} // namespace
+
+void set_parallel_for_backend(ParallelForBackend backend)
+{
+    parallel_for_backend = backend;
+}
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -76,15 +95,26 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
         func(i);
     }
 #else
-#ifndef NO_OMP_MULTITHREADING
-    parallel_for_omp(num_iterations, func);
-#else
-    // parallel_for_spawning(num_iterations, func);
-    // parallel_for_moody(num_iterations, func);
-    // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
-    // parallel_for_queued(num_iterations, func);
-#endif
+    switch (parallel_for_backend.load(std::memory_order_relaxed)) {
+    case ParallelForBackend::WORK_STEALING:
+        parallel_for_work_stealing(num_iterations, func, 1);
+        break;
+    case ParallelForBackend::MUTEX_POOL:
+        parallel_for_mutex_pool(num_iterations, func);
+        break;
+    case ParallelForBackend::ATOMIC_POOL:
+        parallel_for_atomic_pool(num_iterations, func);
+        break;
+    case ParallelForBackend::QUEUED:
+        parallel_for_queued(num_iterations, func);
+        break;
+    case ParallelForBackend::SPAWNING:
+        parallel_for_spawning(num_iterations, func);
+        break;
+    case ParallelForBackend::OMP:
+        parallel_for_omp(num_iterations, func);
+        break;
+    }
 #endif
 }
 
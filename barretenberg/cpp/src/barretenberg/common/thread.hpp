@@ -20,6 +20,12 @@ inline size_t get_num_cpus_pow2()
 }
 
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+// The implementations `parallel_for` can dispatch to. The default is WORK_STEALING, or OMP when building with
+// OMP_MULTITHREADING; the others are kept around to benchmark against (see parallel_for_bench).
+enum class ParallelForBackend { WORK_STEALING, MUTEX_POOL, ATOMIC_POOL, QUEUED, SPAWNING, OMP };
+void set_parallel_for_backend(ParallelForBackend backend);
+
 void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal = 0);
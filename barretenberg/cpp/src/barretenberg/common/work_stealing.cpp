@@ -0,0 +1,306 @@
+#include "work_stealing.hpp"
+#include "thread.hpp"
+
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+struct Task {
+    std::function<void()> func;
+    bb::TaskGroup* group;
+};
+
+/**
+ * A pool of workers, each owning a deque of tasks. The owner pushes and pops at the back (so it works depth-first on
+ * what it forked last, which is still warm in cache), thieves take from the front (the oldest and, for recursively
+ * split loops, largest piece of work). Threads that are not workers (e.g. the main thread) share one extra deque.
+ */
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_workers);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    static WorkStealingPool& get()
+    {
+        static WorkStealingPool pool(bb::get_num_cpus() - 1);
+        return pool;
+    }
+
+    size_t num_workers() const { return workers.size(); }
+
+    void push(Task* task);
+    Task* try_pop();
+    static void execute(Task* task);
+
+  private:
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::deque<Task*> tasks;
+    };
+
+    std::vector<std::thread> workers;
+    // One deque per worker, plus the deque shared by external threads at index num_workers()
+    std::unique_ptr<TaskQueue[]> queues;
+    size_t num_queues;
+    std::atomic<size_t> num_queued = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t current_queue_index() const;
+    BB_NO_PROFILE void worker_loop(size_t worker_index);
+};
+
+constexpr size_t NOT_A_WORKER = SIZE_MAX;
+thread_local size_t worker_queue_index = NOT_A_WORKER;
+
+WorkStealingPool::WorkStealingPool(size_t num_workers)
+    : queues(new TaskQueue[num_workers + 1])
+    , num_queues(num_workers + 1)
+{
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t WorkStealingPool::current_queue_index() const
+{
+    return worker_queue_index == NOT_A_WORKER ? num_queues - 1 : worker_queue_index;
+}
+
+void WorkStealingPool::push(Task* task)
+{
+    TaskQueue& queue = queues[current_queue_index()];
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+    num_queued.fetch_add(1);
+    // A worker that is about to sleep re-checks `num_queued` while holding `sleep_mutex`, so taking the mutex here
+    // guarantees it either sees the new task or is already waiting when we notify.
+    if (num_sleeping.load() > 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex); }
+        sleep_condition.notify_one();
+    }
+}
+
+Task* WorkStealingPool::try_pop()
+{
+    if (num_queued.load() == 0) {
+        return nullptr;
+    }
+    const size_t own_index = current_queue_index();
+    {
+        TaskQueue& queue = queues[own_index];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            Task* task = queue.tasks.back();
+            queue.tasks.pop_back();
+            num_queued.fetch_sub(1);
+            return task;
+        }
+    }
+    for (size_t i = 1; i < num_queues; ++i) {
+        TaskQueue& queue = queues[(own_index + i) % num_queues];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            Task* task = queue.tasks.front();
+            queue.tasks.pop_front();
+            num_queued.fetch_sub(1);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingPool::execute(Task* task)
+{
+    std::exception_ptr exception;
+    try {
+        task->func();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    bb::TaskGroup* group = task->group;
+    delete task;
+    group->complete(exception);
+}
+
+void WorkStealingPool::worker_loop(size_t worker_index)
+{
+    constexpr size_t NUM_SPINS_BEFORE_SLEEP = 64;
+    worker_queue_index = worker_index;
+    while (true) {
+        Task* task = nullptr;
+        for (size_t i = 0; i < NUM_SPINS_BEFORE_SLEEP && task == nullptr; ++i) {
+            task = try_pop();
+            if (task == nullptr) {
+                std::this_thread::yield();
+            }
+        }
+        if (task != nullptr) {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping.fetch_add(1);
+        sleep_condition.wait(lock, [this] { return num_queued.load() > 0 || stop; });
+        num_sleeping.fetch_sub(1);
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+
+TaskGroup::~TaskGroup()
+{
+    help_until_done();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+    num_pending_.fetch_add(1);
+    WorkStealingPool::get().push(new Task{ std::move(task), this });
+}
+
+void TaskGroup::complete(std::exception_ptr exception)
+{
+    if (exception) {
+        std::unique_lock<std::mutex> lock(exception_mutex_);
+        if (!exception_) {
+            exception_ = exception;
+        }
+    }
+    num_pending_.fetch_sub(1, std::memory_order_release);
+}
+
+void TaskGroup::help_until_done()
+{
+    auto& pool = WorkStealingPool::get();
+    while (num_pending_.load(std::memory_order_acquire) != 0) {
+        if (Task* task = pool.try_pop()) {
+            WorkStealingPool::execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void TaskGroup::wait()
+{
+    help_until_done();
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(exception_mutex_);
+        std::swap(exception, exception_);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func, size_t grain_size)
+{
+    grain_size = std::max<size_t>(grain_size, 1);
+    if (num_iterations <= grain_size || WorkStealingPool::get().num_workers() == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    TaskGroup group;
+    // Fork off the upper half of the range until what is left is a single grain, which we run ourselves
+    std::function<void(size_t, size_t)> split = [&](size_t begin, size_t end) {
+        while (end - begin > grain_size) {
+            const size_t mid = begin + (end - begin) / 2;
+            group.run([&split, mid, end] { split(mid, end); });
+            end = mid;
+        }
+        for (size_t i = begin; i < end; ++i) {
+            func(i);
+        }
+    };
+    split(0, num_iterations);
+    group.wait();
+}
+
+} // namespace bb
+
+#else
+
+namespace bb {
+
+TaskGroup::~TaskGroup() = default;
+
+void TaskGroup::run(std::function<void()> task)
+{
+    num_pending_.fetch_add(1);
+    std::exception_ptr exception;
+    try {
+        task();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    complete(exception);
+}
+
+void TaskGroup::complete(std::exception_ptr exception)
+{
+    if (exception && !exception_) {
+        exception_ = exception;
+    }
+    num_pending_.fetch_sub(1);
+}
+
+void TaskGroup::help_until_done() {}
+
+void TaskGroup::wait()
+{
+    std::exception_ptr exception;
+    std::swap(exception, exception_);
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func, size_t /*unused*/)
+{
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+}
+
+} // namespace bb
+
+#endif
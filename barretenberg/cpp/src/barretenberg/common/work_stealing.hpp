@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace bb {
+
+/**
+ * @brief A set of tasks forked onto the work-stealing pool, which can be joined with `wait`
+ *
+ * @details Tasks are pushed onto the deque of the calling thread and are stolen by idle workers. A thread that waits
+ * on a group does not block: it keeps executing queued tasks (its own first, then stolen ones) until every task of the
+ * group has completed. Forking and joining from inside a task is therefore safe, and nested parallel loops share the
+ * workers instead of serialising or oversubscribing the machine.
+ *
+ * If a task throws, the first exception is rethrown by `wait` once all of the group's tasks have finished.
+ *
+ * e.g.
+ *     TaskGroup group;
+ *     group.run([&] { commit_to_wires(); });
+ *     group.run([&] { compute_sorted_accumulator(); });
+ *     group.wait();
+ */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    ~TaskGroup();
+
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+
+    void run(std::function<void()> task);
+    void wait();
+
+    // Called by the pool when one of the group's tasks has run
+    void complete(std::exception_ptr exception);
+
+  private:
+    std::atomic<size_t> num_pending_ = 0;
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+
+    void help_until_done();
+};
+
+/**
+ * @brief A `parallel_for` on the work-stealing pool, with control over the size of the smallest unit of work.
+ *
+ * @details The iteration range is split recursively in halves until ranges have at most `grain_size` iterations, so
+ * idle threads steal large ranges first and load imbalance between iterations is evened out. Unlike the pooled
+ * `parallel_for` backends this may be called from within another parallel loop or task.
+ *
+ * @param grain_size The number of consecutive iterations run as a single task
+ */
+void parallel_for_work_stealing(size_t num_iterations,
+                                const std::function<void(size_t)>& func,
+                                size_t grain_size = 1);
+
+} // namespace bb
@@ -0,0 +1,77 @@
+#include "work_stealing.hpp"
+#include "thread.hpp"
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace bb;
+
+TEST(WorkStealing, ParallelForVisitsEveryIteration)
+{
+    for (const size_t grain_size : { 1, 3, 64, 5000 }) {
+        std::vector<size_t> visits(1000, 0);
+        parallel_for_work_stealing(visits.size(), [&](size_t i) { visits[i]++; }, grain_size);
+        for (const size_t count : visits) {
+            EXPECT_EQ(count, 1);
+        }
+    }
+}
+
+TEST(WorkStealing, NestedParallelFor)
+{
+    constexpr size_t NUM_OUTER = 16;
+    constexpr size_t NUM_INNER = 256;
+    std::vector<std::vector<size_t>> results(NUM_OUTER, std::vector<size_t>(NUM_INNER, 0));
+
+    parallel_for(NUM_OUTER, [&](size_t i) {
+        parallel_for(NUM_INNER, [&](size_t j) { results[i][j] = i * NUM_INNER + j; });
+    });
+
+    for (size_t i = 0; i < NUM_OUTER; ++i) {
+        for (size_t j = 0; j < NUM_INNER; ++j) {
+            EXPECT_EQ(results[i][j], i * NUM_INNER + j);
+        }
+    }
+}
+
+TEST(WorkStealing, RecursiveTaskGroups)
+{
+    // Recursive fork/join sum of 0..n-1
+    std::function<size_t(size_t, size_t)> sum = [&](size_t begin, size_t end) -> size_t {
+        if (end - begin <= 8) {
+            size_t result = 0;
+            for (size_t i = begin; i < end; ++i) {
+                result += i;
+            }
+            return result;
+        }
+        const size_t mid = begin + (end - begin) / 2;
+        size_t left = 0;
+        TaskGroup group;
+        group.run([&] { left = sum(begin, mid); });
+        const size_t right = sum(mid, end);
+        group.wait();
+        return left + right;
+    };
+
+    constexpr size_t N = 100000;
+    EXPECT_EQ(sum(0, N), N * (N - 1) / 2);
+}
+
+TEST(WorkStealing, TaskExceptionIsRethrownByWait)
+{
+    TaskGroup group;
+    std::atomic<size_t> num_completed = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        group.run([&, i] {
+            if (i == 3) {
+                throw std::runtime_error("task failed");
+            }
+            num_completed++;
+        });
+    }
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(num_completed, 7);
+}
@@ -1,5 +1,8 @@
 #pragma once
+#include "../dense_node_store.hpp"
 #include "../hash_path.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <span>
 
 namespace bb::crypto::merkle_tree {
 
@@ -26,6 +29,7 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
 
     /**
      * @brief Adds the given set of values to the end of the tree
+     * @details The new nodes are hashed level by level, each level in parallel, and then written to the store
      */
     virtual fr add_values(const std::vector<fr>& values);
 
@@ -49,8 +53,21 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
      */
     fr_hash_path get_hash_path(const index_t& index) const;
 
+    /**
+     * @brief Returns the hash path from the leaf at the given index to the root, as pointers into the store (or to the
+     * zero hashes for absent nodes) rather than copies
+     */
+    fr_hash_path_view get_hash_path_view(const index_t& index) const
+        requires NodeViewStore<Store>;
+
   protected:
+    // Levels with fewer new nodes than this are hashed on a single thread
+    static constexpr size_t MIN_PARALLEL_HASHES = 4;
+
     fr get_element_or_zero(size_t level, const index_t& index) const;
+    const fr& get_element_or_zero_view(size_t level, const index_t& index) const
+        requires NodeViewStore<Store>;
+    index_t find_size() const;
 
     void write_node(size_t level, const index_t& index, const fr& value);
     std::pair<bool, fr> read_node(size_t level, const index_t& index) const;
@@ -79,6 +96,13 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, size_t depth,
     }
     zero_hashes_[0] = current;
     root_ = current;
+
+    // If the store already holds a tree (e.g. a persistent store being reopened), resume from its root
+    const std::pair<bool, fr> stored_root = read_node(0, 0);
+    if (stored_root.first) {
+        root_ = stored_root.second;
+        size_ = find_size();
+    }
 }
 
 template <typename Store, typename HashingPolicy> AppendOnlyTree<Store, HashingPolicy>::~AppendOnlyTree() {}
@@ -101,6 +125,14 @@ template <typename Store, typename HashingPolicy> size_t AppendOnlyTree<Store, H
 template <typename Store, typename HashingPolicy>
 fr_hash_path AppendOnlyTree<Store, HashingPolicy>::get_hash_path(const index_t& index) const
 {
+    if constexpr (NodeViewStore<Store>) {
+        const fr_hash_path_view view = get_hash_path_view(index);
+        fr_hash_path path(view.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            path[i] = std::make_pair(*view[i].first, *view[i].second);
+        }
+        return path;
+    }
     fr_hash_path path;
     index_t current_index = index;
 
@@ -116,6 +148,21 @@ fr_hash_path AppendOnlyTree<Store, HashingPolicy>::get_hash_path(const index_t&
     return path;
 }
 
+template <typename Store, typename HashingPolicy>
+fr_hash_path_view AppendOnlyTree<Store, HashingPolicy>::get_hash_path_view(const index_t& index) const
+    requires NodeViewStore<Store>
+{
+    fr_hash_path_view path(depth_);
+    index_t current_index = index;
+    for (size_t level = depth_; level > 0; --level) {
+        const index_t left_index = current_index & ~index_t(1);
+        path[depth_ - level] = std::make_pair(&get_element_or_zero_view(level, left_index),
+                                              &get_element_or_zero_view(level, left_index + 1));
+        current_index >>= 1;
+    }
+    return path;
+}
+
 template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, HashingPolicy>::add_value(const fr& value)
 {
     return add_values(std::vector<fr>{ value });
@@ -124,46 +171,65 @@ template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, Hashi
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& values)
 {
-    index_t index = size();
-    size_t number_to_insert = values.size();
-    size_t level = depth_;
-    std::vector<fr> hashes = values;
-
-    // Add the values at the leaf nodes of the tree
-    for (size_t i = 0; i < number_to_insert; ++i) {
-        write_node(level, index + i, hashes[i]);
-    }
-
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
-            write_node(level, index + i, hashes[i]);
+    if (values.empty()) {
+        return root_;
+    }
+    // The new nodes of each level form a contiguous range [start, end). Working up one level at a time, the nodes of
+    // the range above are hashed in parallel from the range below, padded with the stored siblings at either end.
+    index_t start = size_;
+    index_t end = size_ + values.size();
+    std::vector<std::vector<fr>> levels(depth_ + 1);
+    std::vector<index_t> level_starts(depth_ + 1);
+    levels[depth_] = values;
+    level_starts[depth_] = start;
+
+    for (size_t level = depth_; level > 0; --level) {
+        const std::vector<fr>& nodes = levels[level];
+        const bool has_left_sibling = bool(start & 0x01);
+        const bool has_right_sibling = bool(end & 0x01);
+        std::vector<fr> children;
+        children.reserve(nodes.size() + 2);
+        if (has_left_sibling) {
+            children.push_back(get_element_or_zero(level, start - 1));
+        }
+        children.insert(children.end(), nodes.begin(), nodes.end());
+        if (has_right_sibling) {
+            children.push_back(get_element_or_zero(level, end));
         }
+
+        std::vector<fr> parents(children.size() / 2);
+        run_loop_in_parallel(
+            parents.size(),
+            [&](size_t begin, size_t finish) {
+                HashingPolicy::hash_pairs(std::span<const fr>(children).subspan(2 * begin, 2 * (finish - begin)),
+                                          std::span<fr>(parents).subspan(begin, finish - begin));
+            },
+            MIN_PARALLEL_HASHES);
+
+        start >>= 1;
+        end = start + parents.size();
+        levels[level - 1] = std::move(parents);
+        level_starts[level - 1] = start;
     }
 
-    // Hash from the root of the sub-tree to the root of the overall tree
-    fr new_hash = hashes[0];
-    while (level > 0) {
-        bool is_right = bool(index & 0x01);
-        fr left_hash = is_right ? get_element_or_zero(level, index - 1) : new_hash;
-        fr right_hash = is_right ? new_hash : get_element_or_zero(level, index + 1);
-        new_hash = HashingPolicy::hash_pair(left_hash, right_hash);
-        index >>= 1;
-        --level;
-        write_node(level, index, new_hash);
+    // The new nodes only depend on nodes that were already in the store, so they can all be written at the end
+    for (size_t level = 0; level <= depth_; ++level) {
+        const std::vector<fr>& nodes = levels[level];
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            write_node(level, level_starts[level] + i, nodes[i]);
+        }
     }
     size_ += values.size();
-    root_ = new_hash;
+    root_ = levels[0][0];
     return root_;
 }
 
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const index_t& index) const
 {
+    if constexpr (NodeViewStore<Store>) {
+        return get_element_or_zero_view(level, index);
+    }
     const std::pair<bool, fr> read_data = read_node(level, index);
     if (read_data.first) {
         return read_data.second;
@@ -172,9 +238,53 @@ fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const
     return zero_hashes_[level];
 }
 
+template <typename Store, typename HashingPolicy>
+const fr& AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero_view(size_t level, const index_t& index) const
+    requires NodeViewStore<Store>
+{
+    const fr* node = store_.find(level, size_t(index));
+    if (node != nullptr) {
+        return *node;
+    }
+    return zero_hashes_[level];
+}
+
+/**
+ * @brief Recovers the number of leaves of a stored tree, from the leaves being written contiguously from index 0
+ */
+template <typename Store, typename HashingPolicy> index_t AppendOnlyTree<Store, HashingPolicy>::find_size() const
+{
+    const index_t max_size = index_t(1) << depth_;
+    if (!read_node(depth_, 0).first) {
+        return 0;
+    }
+    // Double the upper bound until it is past the last leaf, then binary search for the last leaf
+    index_t lower = 1;
+    index_t upper = 2;
+    while (upper <= max_size && read_node(depth_, upper - 1).first) {
+        lower = upper;
+        upper <<= 1;
+    }
+    upper = upper > max_size ? max_size + 1 : upper;
+    // The leaf at lower - 1 is present and the one at upper - 1 is not (or is past the end of the tree)
+    while (upper - lower > 1) {
+        const index_t mid = lower + ((upper - lower) >> 1);
+        if (read_node(depth_, mid - 1).first) {
+            lower = mid;
+        } else {
+            upper = mid;
+        }
+    }
+    return lower;
+}
+
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_t& index, const fr& value)
 {
+    if constexpr (NodeViewStore<Store>) {
+        store_.put_node(level, size_t(index), value);
+        return;
+    }
     std::vector<uint8_t> buf;
     write(buf, value);
     store_.put(level, size_t(index), buf);
@@ -183,6 +293,10 @@ void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_
 template <typename Store, typename HashingPolicy>
 std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node(size_t level, const index_t& index) const
 {
+    if constexpr (NodeViewStore<Store>) {
+        const fr* node = store_.find(level, size_t(index));
+        return node != nullptr ? std::make_pair(true, *node) : std::make_pair(false, fr::zero());
+    }
     std::vector<uint8_t> buf;
     bool available = store_.get(level, size_t(index), buf);
     if (!available) {
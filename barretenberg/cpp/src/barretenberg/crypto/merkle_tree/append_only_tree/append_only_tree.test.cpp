@@ -1,5 +1,6 @@
 #include "append_only_tree.hpp"
 #include "../array_store.hpp"
+#include "../dense_node_store.hpp"
 #include "../memory_tree.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/common/test.hpp"
@@ -125,3 +126,54 @@ TEST(stdlib_append_only_tree, can_be_filled)
     EXPECT_EQ(tree.get_hash_path(0), memdb.get_hash_path(0));
     EXPECT_EQ(tree.get_hash_path(7), memdb.get_hash_path(7));
 }
+
+TEST(stdlib_append_only_tree, can_add_batches_of_any_size)
+{
+    constexpr size_t depth = 10;
+    ArrayStore store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Batches which start and end at odd and even indices, including ones spanning several subtrees
+    size_t index = 0;
+    for (const size_t batch_size : { 1, 3, 2, 7, 16, 33, 1, 64, 100 }) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(index),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(index + batch_size));
+        fr mock_root;
+        for (size_t i = 0; i < batch_size; ++i) {
+            mock_root = memdb.update_element(index + i, batch[i]);
+        }
+        EXPECT_EQ(tree.add_values(batch), mock_root);
+        index += batch_size;
+        EXPECT_EQ(tree.size(), index);
+        EXPECT_EQ(tree.get_hash_path(index - 1), memdb.get_hash_path(index - 1));
+        EXPECT_EQ(tree.get_hash_path(index / 2), memdb.get_hash_path(index / 2));
+    }
+}
+
+TEST(stdlib_append_only_tree, dense_node_store_matches_array_store)
+{
+    constexpr size_t depth = 10;
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> expected(array_store, depth);
+    DenseNodeStore dense_store(depth);
+    AppendOnlyTree<DenseNodeStore, Poseidon2HashPolicy> tree(dense_store, depth);
+
+    size_t index = 0;
+    for (const size_t batch_size : { 1, 5, 32, 100 }) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(index),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(index + batch_size));
+        EXPECT_EQ(tree.add_values(batch), expected.add_values(batch));
+        index += batch_size;
+    }
+    for (size_t i = 0; i < index + 10; i += 7) {
+        const fr_hash_path path = expected.get_hash_path(i);
+        EXPECT_EQ(tree.get_hash_path(i), path);
+        const fr_hash_path_view view = tree.get_hash_path_view(i);
+        ASSERT_EQ(view.size(), path.size());
+        for (size_t j = 0; j < view.size(); ++j) {
+            EXPECT_EQ(*view[j].first, path[j].first);
+            EXPECT_EQ(*view[j].second, path[j].second);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <atomic>
+#include <concepts>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A dense in-memory backing store for merkle trees, holding the nodes in place as field elements
+ *
+ * @details Every level is a single contiguous array of 32-byte slots (level l has min(2^l, indices) of them) plus a
+ * bitmap recording which slots have been written. Unlike the ArrayStore, which allocates a byte vector per node and
+ * copies it out on every read, nodes are read through `find`, which returns a pointer into the level without copying.
+ * Absent nodes have no value here: trees fall back on their per-level zero hashes, which they compute once.
+ *
+ * Writes to distinct slots may happen concurrently, as the IndexedTree does.
+ */
+class DenseNodeStore {
+  public:
+    DenseNodeStore(size_t levels, size_t indices = 1024)
+        : nodes_(levels + 1)
+        , present_(levels + 1)
+    {
+        for (size_t level = 0; level <= levels; ++level) {
+            const size_t level_size = level < 64 ? std::min(indices, size_t(1) << level) : indices;
+            nodes_[level].resize(level_size);
+            present_[level] = std::vector<std::atomic<uint64_t>>((level_size + 63) / 64);
+        }
+    }
+    DenseNodeStore(const DenseNodeStore& other) = delete;
+    DenseNodeStore(DenseNodeStore&& other) = default;
+    ~DenseNodeStore() = default;
+
+    DenseNodeStore& operator=(const DenseNodeStore& other) = delete;
+    DenseNodeStore& operator=(DenseNodeStore&& other) = default;
+
+    /**
+     * @brief Returns a pointer to the node, or nullptr if it has not been written
+     */
+    const fr* find(size_t level, size_t index) const
+    {
+        if (index >= nodes_[level].size()) {
+            return nullptr;
+        }
+        // Pairs with the release in put_node, so that a set bit guarantees the slot's value is visible
+        const uint64_t word = present_[level][index >> 6].load(std::memory_order_acquire);
+        return ((word >> (index & 63)) & 1) != 0 ? &nodes_[level][index] : nullptr;
+    }
+
+    void put_node(size_t level, size_t index, const fr& value)
+    {
+        ASSERT(index < nodes_[level].size());
+        nodes_[level][index] = value;
+        present_[level][index >> 6].fetch_or(uint64_t(1) << (index & 63), std::memory_order_release);
+    }
+
+    // The byte interface shared with the other stores
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data)
+    {
+        put_node(level, index, from_buffer<fr>(data, 0));
+    }
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const
+    {
+        const fr* node = find(level, index);
+        if (node != nullptr) {
+            data.clear();
+            write(data, *node);
+        }
+        return node != nullptr;
+    }
+
+  private:
+    std::vector<std::vector<fr>> nodes_;
+    std::vector<std::vector<std::atomic<uint64_t>>> present_;
+};
+
+/**
+ * @brief A store which holds its nodes in place as field elements, so that trees can read them without copying
+ */
+template <typename Store>
+concept NodeViewStore = requires(Store& store, const Store& const_store, size_t level, size_t index, const fr& value) {
+    {
+        const_store.find(level, index)
+    } -> std::same_as<const fr*>;
+    store.put_node(level, index, value);
+};
+
+} // namespace bb::crypto::merkle_tree
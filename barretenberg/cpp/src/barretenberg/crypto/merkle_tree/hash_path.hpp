@@ -8,6 +8,8 @@ namespace bb::crypto::merkle_tree {
 
 using fr = bb::stdlib::fr;
 using fr_hash_path = std::vector<std::pair<fr, fr>>;
+// A hash path as pointers to the (left, right) nodes held by the tree, which stay valid until the tree is next modified
+using fr_hash_path_view = std::vector<std::pair<const fr*, const fr*>>;
 using fr_sibling_path = std::vector<fr>;
 template <typename Ctx> using hash_path = std::vector<std::pair<bb::stdlib::field_t<Ctx>, bb::stdlib::field_t<Ctx>>>;
 
@@ -65,6 +65,11 @@ template <typename Store, typename LeavesStore, typename HashingPolicy>
 class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
   public:
     IndexedTree(Store& store, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
+    /**
+     * @brief Construct the tree over an existing set of leaves. If the leaves store is not empty, the tree is assumed to
+     * have been restored from the store and the initial leaves are not inserted.
+     */
+    IndexedTree(Store& store, LeavesStore leaves, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
     IndexedTree(IndexedTree const& other) = delete;
     IndexedTree(IndexedTree&& other) = delete;
     ~IndexedTree();
@@ -131,7 +136,14 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
                                                             size_t depth,
                                                             size_t initial_size,
                                                             uint8_t tree_id)
+    : IndexedTree(store, LeavesStore(), depth, initial_size, tree_id)
+{}
+
+template <typename Store, typename LeavesStore, typename HashingPolicy>
+IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(
+    Store& store, LeavesStore leaves, size_t depth, size_t initial_size, uint8_t tree_id)
     : AppendOnlyTree<Store, HashingPolicy>(store, depth, tree_id)
+    , leaves_(std::move(leaves))
 {
     ASSERT(initial_size > 0);
     zero_hashes_.resize(depth + 1);
@@ -144,6 +156,9 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
         current = HashingPolicy::hash_pair(current, current);
     }
     zero_hashes_[0] = current;
+    if (leaves_.get_size() > 0) {
+        return;
+    }
     // Inserts the initial set of leaves as a chain in incrementing value order
     for (size_t i = 0; i < initial_size; ++i) {
         // Insert the zero leaf to the `leaves` and also to the tree at index 0.
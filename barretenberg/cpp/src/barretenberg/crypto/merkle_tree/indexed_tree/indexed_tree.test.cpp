@@ -1,5 +1,6 @@
 #include "indexed_tree.hpp"
 #include "../array_store.hpp"
+#include "../dense_node_store.hpp"
 #include "../hash.hpp"
 #include "../nullifier_tree/nullifier_memory_tree.hpp"
 #include "barretenberg/common/streams.hpp"
@@ -150,6 +151,34 @@ bool check_hash_path(const fr& root, const fr_hash_path& path, const indexed_lea
     return current == root;
 }
 
+TEST(stdlib_indexed_tree, test_batch_insert_dense_node_store)
+{
+    const size_t batch_size = 16;
+    const size_t num_batches = 16;
+    size_t depth = 10;
+
+    ArrayStore array_store(depth);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> expected =
+        IndexedTree<ArrayStore, LeavesCache, HashPolicy>(array_store, depth, batch_size);
+
+    DenseNodeStore dense_store(depth);
+    IndexedTree<DenseNodeStore, LeavesCache, HashPolicy> tree =
+        IndexedTree<DenseNodeStore, LeavesCache, HashPolicy>(dense_store, depth, batch_size);
+    EXPECT_EQ(tree.root(), expected.root());
+
+    for (size_t i = 0; i < num_batches; i++) {
+        std::vector<fr> batch;
+        for (size_t j = 0; j < batch_size; j++) {
+            batch.push_back(fr(random_engine.get_random_uint256()));
+        }
+        std::vector<fr_hash_path> expected_hash_paths = expected.add_or_update_values(batch, true);
+        std::vector<fr_hash_path> hash_paths = tree.add_or_update_values(batch);
+        EXPECT_EQ(tree.root(), expected.root());
+        EXPECT_EQ(hash_paths, expected_hash_paths);
+    }
+    EXPECT_EQ(tree.get_hash_path(100), expected.get_hash_path(100));
+}
+
 TEST(stdlib_indexed_tree, test_indexed_memory)
 {
     // Create a depth-3 indexed merkle tree
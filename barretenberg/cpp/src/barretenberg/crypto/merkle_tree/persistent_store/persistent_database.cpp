@@ -0,0 +1,410 @@
+#include "persistent_database.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+
+/**
+ * Every committed batch is appended to the log as one record:
+ *
+ * 00   | magic         | RECORD_MAGIC
+ * 04   | version       | The version of the database once the batch is applied
+ * 0C   | body_size     | The size of the body in bytes
+ * 14   | body          | The writes of the batch, each encoded as (u8 op, u32 key size, key[, u32 value size, value])
+ * ..   | checksum      | Checksum of the bytes 00..14 + body_size
+ *
+ * Integers are big-endian. A record is only applied on open if it is complete and its checksum matches.
+ */
+constexpr uint32_t RECORD_MAGIC = 0x42425053; // "BBPS"
+constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t);
+constexpr uint8_t OP_DEL = 0;
+constexpr uint8_t OP_PUT = 1;
+
+uint64_t record_checksum(const uint8_t* data, size_t size)
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+void write_bytes(std::vector<uint8_t>& buf, const std::string& bytes)
+{
+    std::vector<uint8_t> size(sizeof(uint32_t));
+    uint8_t* it = size.data();
+    serialize::write(it, static_cast<uint32_t>(bytes.size()));
+    buf.insert(buf.end(), size.begin(), size.end());
+    buf.insert(buf.end(), bytes.begin(), bytes.end());
+}
+
+bool read_bytes(const uint8_t*& it, const uint8_t* end, std::string& bytes)
+{
+    if (static_cast<size_t>(end - it) < sizeof(uint32_t)) {
+        return false;
+    }
+    uint32_t size = 0;
+    serialize::read(it, size);
+    if (static_cast<size_t>(end - it) < size) {
+        return false;
+    }
+    bytes.assign(reinterpret_cast<const char*>(it), size);
+    it += size;
+    return true;
+}
+
+bool sync_file(FILE* file)
+{
+    return fflush(file) == 0 && fsync(fileno(file)) == 0;
+}
+
+// Makes a rename within the directory durable
+void sync_directory(const std::filesystem::path& path)
+{
+    const auto dir = path.has_parent_path() ? path.parent_path() : std::filesystem::path(".");
+    const int fd = open(dir.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    fsync(fd);
+    close(fd);
+}
+
+} // namespace
+
+PersistentDatabase::Snapshot::Snapshot(Snapshot&& other) noexcept
+    : db_(other.db_)
+    , version_(other.version_)
+{
+    other.db_ = nullptr;
+}
+
+PersistentDatabase::Snapshot::~Snapshot()
+{
+    if (db_ != nullptr) {
+        db_->release_snapshot(version_);
+    }
+}
+
+PersistentDatabase::PersistentDatabase(std::string path, uint64_t compaction_threshold)
+    : path_(std::move(path))
+    , compaction_threshold_(compaction_threshold)
+{
+    replay_log();
+    compacted_log_size_ = log_size_;
+    open_for_append();
+}
+
+PersistentDatabase::~PersistentDatabase()
+{
+    if (file_ != nullptr) {
+        fclose(file_);
+    }
+}
+
+void PersistentDatabase::replay_log()
+{
+    std::ifstream stream(path_, std::ios::binary);
+    if (!stream.good()) {
+        return;
+    }
+    const std::vector<uint8_t> log((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    stream.close();
+
+    const uint8_t* const begin = log.data();
+    const uint8_t* const end = begin + log.size();
+    const uint8_t* record = begin;
+    while (static_cast<size_t>(end - record) >= RECORD_HEADER_SIZE) {
+        const uint8_t* it = record;
+        uint32_t magic = 0;
+        uint64_t version = 0;
+        uint64_t body_size = 0;
+        serialize::read(it, magic);
+        serialize::read(it, version);
+        serialize::read(it, body_size);
+        // Compare against the remaining size rather than body_size + 8, which a corrupt header could overflow
+        const auto remaining = static_cast<uint64_t>(end - it);
+        if (magic != RECORD_MAGIC || version <= version_ || remaining < sizeof(uint64_t) ||
+            body_size > remaining - sizeof(uint64_t)) {
+            break;
+        }
+        const uint8_t* body_end = it + body_size;
+        uint64_t checksum = 0;
+        const uint8_t* checksum_it = body_end;
+        serialize::read(checksum_it, checksum);
+        if (checksum != record_checksum(record, RECORD_HEADER_SIZE + body_size)) {
+            break;
+        }
+
+        std::map<std::string, std::optional<std::string>> ops;
+        bool valid = true;
+        while (it < body_end && valid) {
+            uint8_t op = *it++;
+            std::string key;
+            valid = read_bytes(it, body_end, key);
+            if (valid && op == OP_PUT) {
+                std::string value;
+                valid = read_bytes(it, body_end, value);
+                ops[key] = std::move(value);
+            } else if (valid) {
+                valid = op == OP_DEL;
+                ops[key] = std::nullopt;
+            }
+        }
+        if (!valid) {
+            break;
+        }
+        apply(version, ops);
+        record = checksum_it;
+    }
+
+    // Drop a torn or corrupted tail, so that the next record is appended right after the last valid one
+    log_size_ = static_cast<uint64_t>(record - begin);
+    if (record != end) {
+        info("PersistentDatabase: discarding ", end - record, " bytes of incomplete log records in ", path_);
+        std::filesystem::resize_file(path_, static_cast<uintmax_t>(record - begin));
+    }
+}
+
+void PersistentDatabase::open_for_append()
+{
+    file_ = fopen(path_.c_str(), "ab");
+    if (file_ == nullptr) {
+        throw_or_abort("PersistentDatabase: could not open " + path_);
+    }
+}
+
+// Cut the log back to the given size, dropping a partially appended record. The file is closed first so that bytes
+// still buffered by stdio cannot be flushed after the truncation.
+void PersistentDatabase::truncate_log(uint64_t size)
+{
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+    std::error_code error;
+    std::filesystem::resize_file(path_, size, error);
+    open_for_append();
+    if (error) {
+        throw_or_abort("PersistentDatabase: could not truncate " + path_ + ": " + error.message());
+    }
+}
+
+std::vector<uint8_t> PersistentDatabase::encode_record(Version version,
+                                                       const std::map<std::string, std::optional<std::string>>& ops)
+{
+    std::vector<uint8_t> body;
+    for (const auto& [key, value] : ops) {
+        body.push_back(value.has_value() ? OP_PUT : OP_DEL);
+        write_bytes(body, key);
+        if (value.has_value()) {
+            write_bytes(body, *value);
+        }
+    }
+
+    std::vector<uint8_t> record(RECORD_HEADER_SIZE);
+    uint8_t* it = record.data();
+    serialize::write(it, RECORD_MAGIC);
+    serialize::write(it, static_cast<uint64_t>(version));
+    serialize::write(it, static_cast<uint64_t>(body.size()));
+    record.insert(record.end(), body.begin(), body.end());
+    const uint64_t checksum = record_checksum(record.data(), record.size());
+    record.resize(record.size() + sizeof(uint64_t));
+    it = record.data() + record.size() - sizeof(uint64_t);
+    serialize::write(it, checksum);
+    return record;
+}
+
+// Returns false if the record could not be written in full and synced to disk
+bool PersistentDatabase::append_record(FILE* file, const std::vector<uint8_t>& record)
+{
+    return fwrite(record.data(), 1, record.size(), file) == record.size() && sync_file(file);
+}
+
+void PersistentDatabase::apply(Version version, const std::map<std::string, std::optional<std::string>>& ops)
+{
+    // Values at versions below the oldest live snapshot are only needed if they are the latest ones at that version
+    const Version oldest_needed = live_snapshots_.empty() ? version : *live_snapshots_.begin();
+    for (const auto& [key, value] : ops) {
+        auto& history = entries_[key];
+        history.push_back({ version, value });
+        size_t first_needed = history.size() - 1;
+        while (first_needed > 0 && history[first_needed].version > oldest_needed) {
+            --first_needed;
+        }
+        history.erase(history.begin(), history.begin() + static_cast<std::ptrdiff_t>(first_needed));
+        if (history.size() == 1 && !history.front().value.has_value()) {
+            entries_.erase(key);
+        }
+    }
+    version_ = version;
+}
+
+PersistentDatabase::Version PersistentDatabase::commit(const WriteBatch& batch)
+{
+    std::lock_guard write_lock(write_mutex_);
+    const Version version = version_ + 1;
+    const auto record = encode_record(version, batch.ops_);
+    if (!append_record(file_, record)) {
+        // Replay stops at the first bad record, so the partial bytes must go before anything else is appended
+        truncate_log(log_size_);
+        throw_or_abort("PersistentDatabase: failed to write to the log");
+    }
+    log_size_ += record.size();
+    {
+        std::unique_lock lock(mutex_);
+        apply(version, batch.ops_);
+    }
+    if (log_size_ >= std::max(compaction_threshold_, 2 * compacted_log_size_)) {
+        compact_locked();
+    }
+    return version;
+}
+
+PersistentDatabase::Version PersistentDatabase::version() const
+{
+    std::shared_lock lock(mutex_);
+    return version_;
+}
+
+const PersistentDatabase::Entry* PersistentDatabase::find_entry(const std::vector<Entry>& history, Version version)
+{
+    auto it = std::upper_bound(
+        history.begin(), history.end(), version, [](Version v, const Entry& entry) { return v < entry.version; });
+    if (it == history.begin()) {
+        return nullptr;
+    }
+    return &*std::prev(it);
+}
+
+const std::string* PersistentDatabase::lookup(const std::string& key, Version version) const
+{
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    const Entry* entry = find_entry(it->second, version);
+    if (entry == nullptr || !entry->value.has_value()) {
+        return nullptr;
+    }
+    return &*entry->value;
+}
+
+std::optional<std::pair<std::string, std::string>> PersistentDatabase::lookup_floor(const std::string& key,
+                                                                                     Version version) const
+{
+    auto it = entries_.upper_bound(key);
+    while (it != entries_.begin()) {
+        --it;
+        const Entry* entry = find_entry(it->second, version);
+        if (entry != nullptr && entry->value.has_value()) {
+            return std::make_pair(it->first, *entry->value);
+        }
+    }
+    return std::nullopt;
+}
+
+bool PersistentDatabase::get(const std::string& key, std::string& value) const
+{
+    std::shared_lock lock(mutex_);
+    return get_unlocked(key, value, version_);
+}
+
+bool PersistentDatabase::get(const std::string& key, std::string& value, Version version) const
+{
+    std::shared_lock lock(mutex_);
+    return get_unlocked(key, value, version);
+}
+
+bool PersistentDatabase::get_unlocked(const std::string& key, std::string& value, Version version) const
+{
+    const std::string* found = lookup(key, version);
+    if (found == nullptr) {
+        return false;
+    }
+    value = *found;
+    return true;
+}
+
+std::optional<std::pair<std::string, std::string>> PersistentDatabase::find_floor(const std::string& key) const
+{
+    std::shared_lock lock(mutex_);
+    return lookup_floor(key, version_);
+}
+
+std::optional<std::pair<std::string, std::string>> PersistentDatabase::find_floor(const std::string& key,
+                                                                                   Version version) const
+{
+    std::shared_lock lock(mutex_);
+    return lookup_floor(key, version);
+}
+
+PersistentDatabase::Snapshot PersistentDatabase::snapshot() const
+{
+    std::unique_lock lock(mutex_);
+    live_snapshots_.insert(version_);
+    return Snapshot(this, version_);
+}
+
+void PersistentDatabase::release_snapshot(Version version) const
+{
+    std::unique_lock lock(mutex_);
+    live_snapshots_.erase(live_snapshots_.find(version));
+}
+
+void PersistentDatabase::compact()
+{
+    std::lock_guard write_lock(write_mutex_);
+    compact_locked();
+}
+
+void PersistentDatabase::compact_locked()
+{
+    if (version_ == 0) {
+        return;
+    }
+    std::map<std::string, std::optional<std::string>> latest;
+    {
+        std::shared_lock lock(mutex_);
+        for (const auto& [key, history] : entries_) {
+            if (history.back().value.has_value()) {
+                latest.emplace(key, history.back().value);
+            }
+        }
+    }
+
+    const std::string tmp_path = path_ + ".tmp";
+    FILE* tmp = fopen(tmp_path.c_str(), "wb");
+    if (tmp == nullptr) {
+        throw_or_abort("PersistentDatabase: could not open " + tmp_path);
+    }
+    const auto record = encode_record(version_, latest);
+    const bool written = append_record(tmp, record);
+    fclose(tmp);
+    if (!written) {
+        std::filesystem::remove(tmp_path);
+        throw_or_abort("PersistentDatabase: failed to write " + tmp_path);
+    }
+
+    // The rename is atomic, so a crash leaves either the old or the compacted log in place
+    fclose(file_);
+    std::filesystem::rename(tmp_path, path_);
+    sync_directory(path_);
+    open_for_append();
+    log_size_ = record.size();
+    compacted_log_size_ = log_size_;
+}
+
+} // namespace bb::crypto::merkle_tree
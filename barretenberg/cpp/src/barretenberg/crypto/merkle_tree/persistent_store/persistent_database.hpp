@@ -0,0 +1,188 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A persistent, crash-safe key-value store with ordered keys and versioned snapshots
+ *
+ * @details Writes are grouped into a WriteBatch, and each committed batch (e.g. the updates of one block) becomes the
+ * next version of the database. A batch is appended to a log file as a single checksummed record and synced to disk
+ * before it becomes visible. If the process dies half way through an append, the torn record fails its checksum when
+ * the database is next opened and is discarded, so the database always comes back at the last committed version.
+ *
+ * On open the log is replayed into an ordered in-memory index. Reloading a tree therefore costs one sequential read of
+ * the log and no hashing. `compact` rewrites the log so that it only contains the latest value of every key. Commits
+ * call it automatically once the log has grown past the compaction threshold and to twice its size after the last
+ * compaction, so the log stays within a constant factor of the size of the live data.
+ *
+ * The database is held entirely in memory: the index holds every live key and value, plus the overwritten values that
+ * live snapshots can still see, and opening the database reads the whole log into memory before replaying it. It is
+ * therefore meant for trees whose contents fit in RAM; the log only provides durability.
+ *
+ * A Snapshot is a read-only view of the database at the version it was taken at, which stays valid while further
+ * batches are committed. The database keeps the values overwritten since the oldest live snapshot for that purpose.
+ *
+ * Keys are compared as byte strings, so big-endian encoded integers are ordered numerically.
+ */
+class PersistentDatabase {
+  public:
+    using Version = uint64_t;
+
+    // The log is not compacted automatically before it reaches this size
+    static constexpr uint64_t DEFAULT_COMPACTION_THRESHOLD = 64UL << 20;
+
+    /**
+     * @brief A set of writes which are committed atomically. A later write to the same key replaces an earlier one.
+     */
+    class WriteBatch {
+      public:
+        void put(const std::string& key, std::string value) { ops_[key] = std::move(value); }
+        void del(const std::string& key) { ops_[key] = std::nullopt; }
+        bool empty() const { return ops_.empty(); }
+        size_t size() const { return ops_.size(); }
+        void clear() { ops_.clear(); }
+
+        /**
+         * @brief Look up a key among the writes of the batch
+         * @return std::nullopt if the batch does not touch the key, otherwise the new value (std::nullopt if deleted)
+         */
+        std::optional<std::optional<std::string>> find(const std::string& key) const
+        {
+            auto it = ops_.find(key);
+            if (it == ops_.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+      private:
+        friend class PersistentDatabase;
+        std::map<std::string, std::optional<std::string>> ops_;
+    };
+
+    /**
+     * @brief A read-only view of the database at a fixed version
+     */
+    class Snapshot {
+      public:
+        Snapshot(const Snapshot& other) = delete;
+        Snapshot(Snapshot&& other) noexcept;
+        ~Snapshot();
+
+        Snapshot& operator=(const Snapshot& other) = delete;
+        Snapshot& operator=(Snapshot&& other) = delete;
+
+        Version version() const { return version_; }
+        bool get(const std::string& key, std::string& value) const { return db_->get(key, value, version_); }
+        std::optional<std::pair<std::string, std::string>> find_floor(const std::string& key) const
+        {
+            return db_->find_floor(key, version_);
+        }
+
+      private:
+        friend class PersistentDatabase;
+        Snapshot(const PersistentDatabase* db, Version version)
+            : db_(db)
+            , version_(version)
+        {}
+
+        const PersistentDatabase* db_;
+        Version version_;
+    };
+
+    /**
+     * @brief Open the database stored in the given file, creating it if it does not exist
+     *
+     * @param compaction_threshold The log size in bytes below which commits never compact the log
+     */
+    explicit PersistentDatabase(std::string path, uint64_t compaction_threshold = DEFAULT_COMPACTION_THRESHOLD);
+    PersistentDatabase(const PersistentDatabase& other) = delete;
+    PersistentDatabase(PersistentDatabase&& other) = delete;
+    ~PersistentDatabase();
+
+    PersistentDatabase& operator=(const PersistentDatabase& other) = delete;
+    PersistentDatabase& operator=(PersistentDatabase&& other) = delete;
+
+    /**
+     * @brief Durably write the batch to disk and make it visible
+     * @return The new version of the database
+     */
+    Version commit(const WriteBatch& batch);
+
+    /**
+     * @brief The number of batches committed since the database was created
+     */
+    Version version() const;
+
+    /**
+     * @brief Get the latest value of a key
+     */
+    bool get(const std::string& key, std::string& value) const;
+
+    /**
+     * @brief Find the present key-value pair with the greatest key less than or equal to the given one
+     */
+    std::optional<std::pair<std::string, std::string>> find_floor(const std::string& key) const;
+
+    /**
+     * @brief Take a read-only view of the latest version. The snapshot must not outlive the database.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Atomically replace the log with one holding only the latest value of every key
+     */
+    void compact();
+
+  private:
+    struct Entry {
+        Version version;
+        std::optional<std::string> value; // std::nullopt if the key was deleted at this version
+    };
+
+    std::string path_;
+    FILE* file_ = nullptr;
+    Version version_ = 0;
+    const uint64_t compaction_threshold_;
+    // The size of the valid part of the log, and its size right after it was last compacted or opened
+    uint64_t log_size_ = 0;
+    uint64_t compacted_log_size_ = 0;
+    // Every key with the history of its values, oldest first, as far back as the oldest live snapshot
+    std::map<std::string, std::vector<Entry>> entries_;
+    mutable std::multiset<Version> live_snapshots_;
+    mutable std::shared_mutex mutex_;
+    // Serialises the writers (commit and compact)
+    std::mutex write_mutex_;
+
+    // Reads at a snapshot's version
+    bool get(const std::string& key, std::string& value, Version version) const;
+    std::optional<std::pair<std::string, std::string>> find_floor(const std::string& key, Version version) const;
+
+    // Must be called with mutex_ held
+    bool get_unlocked(const std::string& key, std::string& value, Version version) const;
+    const std::string* lookup(const std::string& key, Version version) const;
+    std::optional<std::pair<std::string, std::string>> lookup_floor(const std::string& key, Version version) const;
+    static const Entry* find_entry(const std::vector<Entry>& history, Version version);
+
+    void replay_log();
+    void open_for_append();
+    void truncate_log(uint64_t size);
+    // Must be called with write_mutex_ held
+    void compact_locked();
+    static std::vector<uint8_t> encode_record(Version version,
+                                              const std::map<std::string, std::optional<std::string>>& ops);
+    static bool append_record(FILE* file, const std::vector<uint8_t>& record);
+    void apply(Version version, const std::map<std::string, std::optional<std::string>>& ops);
+    void release_snapshot(Version version) const;
+};
+
+} // namespace bb::crypto::merkle_tree
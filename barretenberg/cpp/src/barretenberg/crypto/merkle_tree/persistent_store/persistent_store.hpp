@@ -0,0 +1,258 @@
+#pragma once
+#include "../indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "persistent_database.hpp"
+
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A merkle tree node store backed by a PersistentDatabase, for use as the Store of an AppendOnlyTree or
+ * IndexedTree
+ *
+ * @details The nodes of a tree are stored under keys prefixed by the name of the tree, so several trees can share one
+ * database. Writes are buffered in a pending batch, which reads see, until `commit` writes them to the database in a
+ * single transaction (typically once per block). A tree constructed over a store whose database already holds a root
+ * resumes from it, so reopening the database restores the trees without any hashing.
+ *
+ * A store constructed from a Snapshot is read-only and sees the tree as it was when the snapshot was taken.
+ */
+class PersistentStore {
+  public:
+    using Version = PersistentDatabase::Version;
+
+    PersistentStore(PersistentDatabase& db, const std::string& name)
+        : db_(&db)
+        , prefix_(make_prefix(name))
+    {}
+    PersistentStore(const PersistentDatabase::Snapshot& snapshot, const std::string& name)
+        : snapshot_(&snapshot)
+        , prefix_(make_prefix(name))
+    {}
+    PersistentStore(const PersistentStore& other) = delete;
+    PersistentStore(PersistentStore&& other) = delete;
+    ~PersistentStore() = default;
+
+    PersistentStore& operator=(const PersistentStore& other) = delete;
+    PersistentStore& operator=(PersistentStore&& other) = delete;
+
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data)
+    {
+        put(node_key(level, index), std::string(data.begin(), data.end()));
+    }
+
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const
+    {
+        std::string value;
+        if (!get(node_key(level, index), value)) {
+            return false;
+        }
+        data.assign(value.begin(), value.end());
+        return true;
+    }
+
+    /**
+     * @brief Buffer a write of a key in the namespace of this store. Thread-safe.
+     */
+    void put(const std::string& key, std::string value)
+    {
+        ASSERT(db_ != nullptr);
+        std::unique_lock lock(pending_mutex_);
+        pending_[prefix_ + key] = std::move(value);
+    }
+
+    /**
+     * @brief Read a key in the namespace of this store, including the pending writes. Thread-safe.
+     */
+    bool get(const std::string& key, std::string& value) const
+    {
+        const std::string full_key = prefix_ + key;
+        {
+            std::shared_lock lock(pending_mutex_);
+            auto it = pending_.find(full_key);
+            if (it != pending_.end()) {
+                value = it->second;
+                return true;
+            }
+        }
+        return snapshot_ != nullptr ? snapshot_->get(full_key, value) : db_->get(full_key, value);
+    }
+
+    /**
+     * @brief Find the key-value pair of this store with the greatest key less than or equal to the given one
+     * @details Only keys starting with `key_prefix` are considered, so that one store can hold several ordered indices
+     */
+    std::optional<std::pair<std::string, std::string>> find_floor(const std::string& key_prefix,
+                                                                  const std::string& key) const
+    {
+        const std::string full_prefix = prefix_ + key_prefix;
+        const std::string full_key = full_prefix + key;
+        auto in_range = [&](const std::optional<std::pair<std::string, std::string>>& candidate) {
+            return candidate.has_value() && candidate->first.compare(0, full_prefix.size(), full_prefix) == 0;
+        };
+
+        std::optional<std::pair<std::string, std::string>> pending_floor;
+        {
+            std::shared_lock lock(pending_mutex_);
+            auto it = pending_.upper_bound(full_key);
+            if (it != pending_.begin()) {
+                pending_floor = *std::prev(it);
+            }
+        }
+        auto stored_floor = snapshot_ != nullptr ? snapshot_->find_floor(full_key) : db_->find_floor(full_key);
+        if (!in_range(pending_floor)) {
+            pending_floor.reset();
+        }
+        if (!in_range(stored_floor)) {
+            stored_floor.reset();
+        }
+        // The pending writes only ever add or overwrite keys, so the greater of the two floors is the floor of both
+        const bool use_pending =
+            !stored_floor.has_value() || (pending_floor.has_value() && pending_floor->first >= stored_floor->first);
+        auto& result = use_pending ? pending_floor : stored_floor;
+        if (result.has_value()) {
+            result->first.erase(0, full_prefix.size());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Atomically and durably write the pending writes to the database
+     * @return The version of the database that contains them
+     */
+    Version commit()
+    {
+        ASSERT(db_ != nullptr);
+        PersistentDatabase::WriteBatch batch;
+        std::unique_lock lock(pending_mutex_);
+        for (auto& [key, value] : pending_) {
+            batch.put(key, std::move(value));
+        }
+        pending_.clear();
+        return db_->commit(batch);
+    }
+
+    /**
+     * @brief Discard the pending writes. The tree using the store must be reconstructed afterwards.
+     */
+    void rollback()
+    {
+        std::unique_lock lock(pending_mutex_);
+        pending_.clear();
+    }
+
+    size_t num_pending_writes() const
+    {
+        std::shared_lock lock(pending_mutex_);
+        return pending_.size();
+    }
+
+  private:
+    PersistentDatabase* db_ = nullptr;
+    const PersistentDatabase::Snapshot* snapshot_ = nullptr;
+    std::string prefix_;
+    std::map<std::string, std::string> pending_;
+    mutable std::shared_mutex pending_mutex_;
+
+    static std::string make_prefix(const std::string& name)
+    {
+        // Length-prefixed, so that no tree name is a prefix of another one's keys
+        ASSERT(name.size() < 256);
+        return std::string(1, static_cast<char>(name.size())) + name;
+    }
+
+    static std::string node_key(size_t level, size_t index)
+    {
+        std::string key = "n";
+        key.push_back(static_cast<char>(level));
+        for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+            key.push_back(static_cast<char>((static_cast<uint64_t>(index) >> (56 - 8 * i)) & 0xff));
+        }
+        return key;
+    }
+};
+
+/**
+ * @brief The leaves of an IndexedTree stored in a PersistentStore, for use as its LeavesStore
+ *
+ * @details Besides the leaves themselves (keyed by index), the store keeps an index from leaf value to leaf index
+ * under big-endian value keys, so that `find_low_value` is a single ordered floor lookup in the database. The leaves
+ * are written to the pending batch of the node store, so the nodes and leaves of a tree are always committed together.
+ */
+class PersistentLeavesStore {
+  public:
+    explicit PersistentLeavesStore(PersistentStore& store)
+        : store_(&store)
+    {}
+
+    index_t get_size() const
+    {
+        std::string value;
+        if (!store_->get(SIZE_KEY, value)) {
+            return 0;
+        }
+        return from_buffer<index_t>(std::vector<uint8_t>(value.begin(), value.end()));
+    }
+
+    std::pair<bool, index_t> find_low_value(const fr& new_value) const
+    {
+        const std::string value_key = to_key(uint256_t(new_value));
+        auto floor = store_->find_floor(VALUE_PREFIX, value_key);
+        ASSERT(floor.has_value());
+        const index_t index = from_buffer<index_t>(std::vector<uint8_t>(floor->second.begin(), floor->second.end()));
+        return std::make_pair(floor->first == value_key, index);
+    }
+
+    indexed_leaf get_leaf(const index_t& index) const
+    {
+        std::string value;
+        bool found = store_->get(LEAF_PREFIX + to_key(index), value);
+        ASSERT(found);
+        std::vector<uint8_t> buf(value.begin(), value.end());
+        const uint8_t* it = buf.data();
+        indexed_leaf leaf;
+        read(it, leaf.value);
+        read(it, leaf.nextIndex);
+        read(it, leaf.nextValue);
+        return leaf;
+    }
+
+    void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
+    {
+        std::vector<uint8_t> buf;
+        write(buf, leaf.value);
+        write(buf, leaf.nextIndex);
+        write(buf, leaf.nextValue);
+        store_->put(LEAF_PREFIX + to_key(index), std::string(buf.begin(), buf.end()));
+        if (add_to_index) {
+            store_->put(VALUE_PREFIX + to_key(uint256_t(leaf.value)), to_key(index));
+        }
+        if (index >= get_size()) {
+            store_->put(SIZE_KEY, to_key(index + 1));
+        }
+    }
+
+    void append_leaf(const indexed_leaf& leaf) { set_at_index(get_size(), leaf, true); }
+
+  private:
+    static constexpr const char* SIZE_KEY = "s";
+    static constexpr const char* LEAF_PREFIX = "l";
+    static constexpr const char* VALUE_PREFIX = "v";
+
+    PersistentStore* store_;
+
+    // Big-endian, so that keys are ordered by value
+    static std::string to_key(const uint256_t& value)
+    {
+        std::vector<uint8_t> buf;
+        write(buf, value);
+        return std::string(buf.begin(), buf.end());
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
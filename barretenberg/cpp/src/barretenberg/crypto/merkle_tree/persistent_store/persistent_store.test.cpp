@@ -0,0 +1,310 @@
+#include "persistent_store.hpp"
+#include "../append_only_tree/append_only_tree.hpp"
+#include "../array_store.hpp"
+#include "../hash.hpp"
+#include "../indexed_tree/indexed_tree.hpp"
+#include "../indexed_tree/leaves_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "persistent_database.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+using HashPolicy = Poseidon2HashPolicy;
+
+namespace {
+auto& random_engine = numeric::get_randomness();
+
+std::vector<fr> random_values(size_t num_values)
+{
+    std::vector<fr> values(num_values);
+    for (auto& value : values) {
+        value = fr(random_engine.get_random_uint256());
+    }
+    return values;
+}
+} // namespace
+
+class PersistentStoreTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() /
+                ("bb_persistent_store_" + std::to_string(random_engine.get_random_uint64()) + ".log"))
+                   .string();
+    }
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".tmp");
+    }
+
+    std::string path;
+};
+
+TEST_F(PersistentStoreTest, DatabaseSurvivesReopen)
+{
+    {
+        PersistentDatabase db(path);
+        PersistentDatabase::WriteBatch batch;
+        batch.put("a", "1");
+        batch.put("b", "2");
+        EXPECT_EQ(db.commit(batch), 1);
+        batch.clear();
+        batch.put("a", "3");
+        batch.del("b");
+        EXPECT_EQ(db.commit(batch), 2);
+    }
+    PersistentDatabase db(path);
+    std::string value;
+    EXPECT_EQ(db.version(), 2);
+    EXPECT_TRUE(db.get("a", value));
+    EXPECT_EQ(value, "3");
+    EXPECT_FALSE(db.get("b", value));
+}
+
+TEST_F(PersistentStoreTest, DatabaseDiscardsTornRecord)
+{
+    {
+        PersistentDatabase db(path);
+        PersistentDatabase::WriteBatch batch;
+        batch.put("a", "1");
+        db.commit(batch);
+        batch.clear();
+        batch.put("a", "2");
+        db.commit(batch);
+    }
+    // Simulate a crash half way through writing the second record
+    const auto full_size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, full_size - 5);
+    {
+        PersistentDatabase db(path);
+        std::string value;
+        EXPECT_EQ(db.version(), 1);
+        EXPECT_TRUE(db.get("a", value));
+        EXPECT_EQ(value, "1");
+
+        // New records are appended after the last valid one
+        PersistentDatabase::WriteBatch batch;
+        batch.put("b", "3");
+        EXPECT_EQ(db.commit(batch), 2);
+    }
+    PersistentDatabase db(path);
+    std::string value;
+    EXPECT_EQ(db.version(), 2);
+    EXPECT_TRUE(db.get("b", value));
+    EXPECT_EQ(value, "3");
+}
+
+TEST_F(PersistentStoreTest, DatabaseSnapshotsAndFloor)
+{
+    PersistentDatabase db(path);
+    PersistentDatabase::WriteBatch batch;
+    batch.put("k10", "a");
+    batch.put("k20", "b");
+    db.commit(batch);
+
+    auto snapshot = db.snapshot();
+    batch.clear();
+    batch.put("k10", "c");
+    batch.put("k15", "d");
+    batch.del("k20");
+    db.commit(batch);
+
+    std::string value;
+    EXPECT_TRUE(snapshot.get("k10", value));
+    EXPECT_EQ(value, "a");
+    EXPECT_TRUE(snapshot.get("k20", value));
+    EXPECT_FALSE(snapshot.get("k15", value));
+    EXPECT_EQ(snapshot.find_floor("k17")->first, "k10");
+    EXPECT_EQ(snapshot.find_floor("k99")->first, "k20");
+
+    EXPECT_TRUE(db.get("k10", value));
+    EXPECT_EQ(value, "c");
+    EXPECT_FALSE(db.get("k20", value));
+    EXPECT_EQ(db.find_floor("k17")->first, "k15");
+    EXPECT_EQ(db.find_floor("k99")->first, "k15");
+    EXPECT_FALSE(db.find_floor("k0").has_value());
+}
+
+TEST_F(PersistentStoreTest, DatabaseCompaction)
+{
+    {
+        PersistentDatabase db(path);
+        PersistentDatabase::WriteBatch batch;
+        for (size_t i = 0; i < 100; ++i) {
+            batch.clear();
+            batch.put("key", std::to_string(i));
+            batch.put("key" + std::to_string(i % 3), std::to_string(i));
+            db.commit(batch);
+        }
+        const auto size_before = std::filesystem::file_size(path);
+        db.compact();
+        EXPECT_LT(std::filesystem::file_size(path), size_before);
+
+        batch.clear();
+        batch.put("last", "x");
+        db.commit(batch);
+    }
+    PersistentDatabase db(path);
+    std::string value;
+    EXPECT_EQ(db.version(), 101);
+    EXPECT_TRUE(db.get("key", value));
+    EXPECT_EQ(value, "99");
+    EXPECT_TRUE(db.get("key1", value));
+    EXPECT_EQ(value, "97");
+    EXPECT_TRUE(db.get("last", value));
+}
+
+TEST_F(PersistentStoreTest, DatabaseCompactsAutomatically)
+{
+    constexpr uint64_t COMPACTION_THRESHOLD = 1 << 12;
+    {
+        PersistentDatabase db(path, COMPACTION_THRESHOLD);
+        PersistentDatabase::WriteBatch batch;
+        for (size_t i = 0; i < 1000; ++i) {
+            batch.clear();
+            batch.put("key", std::to_string(i));
+            db.commit(batch);
+            // Every commit overwrites the single key, so compaction keeps the log below the threshold
+            EXPECT_LT(std::filesystem::file_size(path), COMPACTION_THRESHOLD);
+        }
+    }
+    PersistentDatabase db(path, COMPACTION_THRESHOLD);
+    std::string value;
+    EXPECT_EQ(db.version(), 1000);
+    EXPECT_TRUE(db.get("key", value));
+    EXPECT_EQ(value, "999");
+}
+
+TEST_F(PersistentStoreTest, DatabaseRejectsOversizedRecordHeader)
+{
+    {
+        PersistentDatabase db(path);
+        PersistentDatabase::WriteBatch batch;
+        batch.put("a", "1");
+        db.commit(batch);
+    }
+    const auto valid_size = std::filesystem::file_size(path);
+    {
+        // A header whose body size would overflow when the checksum size is added to it
+        std::ofstream stream(path, std::ios::binary | std::ios::app);
+        const std::vector<uint8_t> header{ 0x42, 0x42, 0x50, 0x53, 0, 0, 0, 0, 0, 0, 0, 2, 0xff, 0xff,
+                                           0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0, 0, 0, 0, 0, 0, 0, 0 };
+        stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    }
+    PersistentDatabase db(path);
+    std::string value;
+    EXPECT_EQ(db.version(), 1);
+    EXPECT_TRUE(db.get("a", value));
+    EXPECT_EQ(std::filesystem::file_size(path), valid_size);
+}
+
+TEST_F(PersistentStoreTest, AppendOnlyTreeResumesAfterReopen)
+{
+    constexpr size_t depth = 10;
+    const auto values = random_values(300);
+
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, HashPolicy> expected(array_store, depth);
+    expected.add_values(std::vector<fr>(values.begin(), values.begin() + 100));
+    const fr first_root = expected.root();
+
+    {
+        PersistentDatabase db(path);
+        PersistentStore store(db, "data");
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        tree.add_values(std::vector<fr>(values.begin(), values.begin() + 100));
+        EXPECT_EQ(tree.root(), first_root);
+        store.commit();
+
+        // Uncommitted writes are lost
+        tree.add_values(std::vector<fr>(values.begin() + 100, values.end()));
+    }
+
+    PersistentDatabase db(path);
+    PersistentStore store(db, "data");
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    EXPECT_EQ(tree.root(), first_root);
+    EXPECT_EQ(tree.size(), 100);
+
+    expected.add_values(std::vector<fr>(values.begin() + 100, values.end()));
+    tree.add_values(std::vector<fr>(values.begin() + 100, values.end()));
+    EXPECT_EQ(tree.root(), expected.root());
+    EXPECT_EQ(tree.size(), expected.size());
+    for (size_t i = 0; i < values.size(); i += 37) {
+        EXPECT_EQ(tree.get_hash_path(i), expected.get_hash_path(i));
+    }
+}
+
+TEST_F(PersistentStoreTest, SnapshotStoreSeesCommittedTree)
+{
+    constexpr size_t depth = 8;
+    const auto values = random_values(20);
+
+    PersistentDatabase db(path);
+    PersistentStore store(db, "data");
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    tree.add_values(std::vector<fr>(values.begin(), values.begin() + 10));
+    store.commit();
+    const fr block_root = tree.root();
+
+    auto snapshot = db.snapshot();
+    tree.add_values(std::vector<fr>(values.begin() + 10, values.end()));
+    store.commit();
+
+    PersistentStore snapshot_store(snapshot, "data");
+    AppendOnlyTree<PersistentStore, HashPolicy> snapshot_tree(snapshot_store, depth);
+    EXPECT_EQ(snapshot_tree.root(), block_root);
+    EXPECT_EQ(snapshot_tree.size(), 10);
+    EXPECT_NE(tree.root(), block_root);
+}
+
+TEST_F(PersistentStoreTest, IndexedTreeResumesAfterReopen)
+{
+    constexpr size_t depth = 12;
+    constexpr size_t batch_size = 16;
+    const auto values = random_values(batch_size * 8);
+
+    ArrayStore array_store(depth);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> expected(array_store, depth, batch_size);
+
+    {
+        PersistentDatabase db(path);
+        PersistentStore store(db, "nullifiers");
+        IndexedTree<PersistentStore, PersistentLeavesStore, HashPolicy> tree(
+            store, PersistentLeavesStore(store), depth, batch_size);
+        EXPECT_EQ(tree.root(), expected.root());
+        store.commit();
+        for (size_t i = 0; i < 4; ++i) {
+            std::vector<fr> batch(values.begin() + static_cast<std::ptrdiff_t>(i * batch_size),
+                                  values.begin() + static_cast<std::ptrdiff_t>((i + 1) * batch_size));
+            expected.add_or_update_values(batch);
+            tree.add_or_update_values(batch);
+            EXPECT_EQ(tree.root(), expected.root());
+            store.commit();
+        }
+    }
+
+    PersistentDatabase db(path);
+    PersistentStore store(db, "nullifiers");
+    IndexedTree<PersistentStore, PersistentLeavesStore, HashPolicy> tree(
+        store, PersistentLeavesStore(store), depth, batch_size);
+    EXPECT_EQ(tree.root(), expected.root());
+    EXPECT_EQ(tree.size(), expected.size());
+    for (size_t i = 4; i < 8; ++i) {
+        std::vector<fr> batch(values.begin() + static_cast<std::ptrdiff_t>(i * batch_size),
+                              values.begin() + static_cast<std::ptrdiff_t>((i + 1) * batch_size));
+        auto expected_paths = expected.add_or_update_values(batch);
+        auto paths = tree.add_or_update_values(batch);
+        EXPECT_EQ(paths, expected_paths);
+        EXPECT_EQ(tree.root(), expected.root());
+    }
+    for (size_t i = 0; i < batch_size * 9; i += 13) {
+        EXPECT_EQ(tree.get_leaf(i), expected.get_leaf(i));
+    }
+}
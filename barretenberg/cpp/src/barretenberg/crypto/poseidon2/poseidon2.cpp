@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -43,5 +44,33 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+/**
+ * @brief Hashes the pairs (inputs[2i], inputs[2i + 1]) into outputs[i], with the same result as hash({ x, y })
+ * @details A fixed-length hash of two elements absorbs both into the rate of a fresh sponge and squeezes after a single
+ * permutation, so the pairs can be hashed by permuting their initial sponge states as one batch
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    static_assert(Params::t - 1 >= 2, "a pair must fit in the rate of the sponge");
+    ASSERT(inputs.size() == 2 * outputs.size());
+
+    // The sponge IV for a fixed-length input of 2 elements and 1 output
+    const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    std::vector<typename Permutation::State> states(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        auto& state = states[i];
+        state.fill(FF(0));
+        state[0] = inputs[2 * i];
+        state[1] = inputs[2 * i + 1];
+        state[Params::t - 1] = iv;
+    }
+    Permutation::permutation_batch(states);
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        outputs[i] = states[i][0];
+    }
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
\ No newline at end of file
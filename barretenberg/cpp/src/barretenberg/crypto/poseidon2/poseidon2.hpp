@@ -4,6 +4,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -22,6 +24,11 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+    /**
+     * @brief Hashes the pairs (inputs[2i], inputs[2i + 1]) into outputs[i], with the same result as hash({ x, y })
+     * @details The permutations of all pairs are computed together by Poseidon2Permutation::permutation_batch
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
@@ -64,3 +64,19 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    const size_t num_pairs = 13;
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> outputs(num_pairs);
+    Poseidon2::hash_pairs(inputs, outputs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(outputs[i], Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] }));
+    }
+}
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "poseidon2_params.hpp"
+#include "poseidon2_permutation_ifma.hpp"
 
 #include "barretenberg/common/throw_or_abort.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -160,5 +163,147 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // Number of states permuted together by permutation_batch
+    static constexpr size_t BATCH_SIZE = 8;
+    // A batch of states in structure-of-arrays layout: element i of every state is contiguous
+    using BatchState = std::array<std::array<FF, BATCH_SIZE>, t>;
+
+    /**
+     * @brief Applies the permutation to each of the given states in place.
+     * @details The states are processed in groups of BATCH_SIZE. When the target supports AVX-512 IFMA, each group is
+     * permuted in 52-bit limb vectors with one state per lane (see Poseidon2PermutationIfma); otherwise a group is
+     * transposed into a BatchState and every step of the permutation is applied to all of its states before moving
+     * on, which interleaves independent field multiplications and keeps the multipliers busy. The result is
+     * identical to calling `permutation` on each state.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        for (size_t start = 0; start < states.size(); start += BATCH_SIZE) {
+            const size_t count = std::min(BATCH_SIZE, states.size() - start);
+            std::array<State, BATCH_SIZE> group{};
+            std::copy_n(states.begin() + static_cast<std::ptrdiff_t>(start), count, group.begin());
+            permutation_batch(group);
+            std::copy_n(group.begin(), count, states.begin() + static_cast<std::ptrdiff_t>(start));
+        }
+    }
+
+    static void permutation_batch(std::array<State, BATCH_SIZE>& states)
+    {
+#ifdef BB_POSEIDON2_IFMA
+        if constexpr (Poseidon2PermutationIfma<Params>::is_supported) {
+            Poseidon2PermutationIfma<Params>::permutation(states);
+            return;
+        }
+#endif
+        BatchState batch;
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+            for (size_t i = 0; i < t; ++i) {
+                batch[i][lane] = states[lane][i];
+            }
+        }
+        permutation(batch);
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+            for (size_t i = 0; i < t; ++i) {
+                states[lane][i] = batch[i][lane];
+            }
+        }
+    }
+
+    /**
+     * @brief The permutation of a batch of states, in the same order of operations as `permutation`
+     */
+    static void permutation(BatchState& current_state)
+    {
+        // Apply 1st linear layer
+        matrix_multiplication_external(current_state);
+
+        // First set of external rounds
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+
+        // Internal rounds
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& element : current_state[0]) {
+                element += round_constants[i][0];
+            }
+            apply_sbox(current_state[0]);
+            matrix_multiplication_internal(current_state);
+        }
+
+        // Remaining external rounds
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+    }
+
+  private:
+    static void matrix_multiplication_external(BatchState& input)
+    {
+        if constexpr (t == 4) {
+            for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+                State lane_state{ input[0][lane], input[1][lane], input[2][lane], input[3][lane] };
+                matrix_multiplication_4x4(lane_state);
+                for (size_t i = 0; i < t; ++i) {
+                    input[i][lane] = lane_state[i];
+                }
+            }
+        } else {
+            throw_or_abort("not supported");
+        }
+    }
+
+    static void add_round_constants(BatchState& input, const RoundConstants& rc)
+    {
+        for (size_t i = 0; i < t; ++i) {
+            for (auto& element : input[i]) {
+                element += rc[i];
+            }
+        }
+    }
+
+    static void apply_sbox(std::array<FF, BATCH_SIZE>& input)
+    {
+        std::array<FF, BATCH_SIZE> xxxx;
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+            xxxx[lane] = input[lane].sqr();
+        }
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+            xxxx[lane].self_sqr();
+        }
+        for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+            input[lane] *= xxxx[lane];
+        }
+    }
+
+    static void apply_sbox(BatchState& input)
+    {
+        for (auto& lanes : input) {
+            apply_sbox(lanes);
+        }
+    }
+
+    static void matrix_multiplication_internal(BatchState& input)
+    {
+        std::array<FF, BATCH_SIZE> sum = input[0];
+        for (size_t i = 1; i < t; ++i) {
+            for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+                sum[lane] += input[i][lane];
+            }
+        }
+        for (size_t i = 0; i < t; ++i) {
+            for (size_t lane = 0; lane < BATCH_SIZE; ++lane) {
+                input[i][lane] *= internal_matrix_diagonal[i];
+                input[i][lane] += sum[lane];
+            }
+        }
+    }
 };
 } // namespace bb::crypto
\ No newline at end of file
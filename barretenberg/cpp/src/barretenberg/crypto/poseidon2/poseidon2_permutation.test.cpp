@@ -59,3 +59,27 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchMatchesPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Not a multiple of the batch size, to cover the padded last group
+    std::vector<Permutation::State> states(2 * Permutation::BATCH_SIZE + 3);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    states[0] = crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_INPUT;
+    // Elements at the edges of the field
+    states[1] = { fr(0), fr(-1), fr(1), fr(-2) };
+
+    std::vector<Permutation::State> expected;
+    for (const auto& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+    Permutation::permutation_batch(states);
+    EXPECT_EQ(states, expected);
+    EXPECT_EQ(states[0], crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_OUTPUT);
+}
@@ -0,0 +1,400 @@
+#pragma once
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__) && !defined(__wasm__)
+#define BB_POSEIDON2_IFMA 1
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+#include <span>
+
+namespace bb::crypto {
+
+/**
+ * @brief Applies the Poseidon2 permutation to 8 independent states at once using AVX-512 IFMA
+ *
+ * @details Each state element is held in 5 vector registers of 52-bit limbs, one lane per state, so a single
+ * `vpmadd52{lo,hi}uq` advances the Montgomery multiplications of all 8 states. Elements are in Montgomery form with
+ * R = 2^260 and, unlike the scalar field type, are only reduced as far as needed to keep the multiplications correct:
+ *
+ * - a Montgomery product ab is below ab / 2^260 + p, and p < 2^254, so the S-box of an input below 17p has
+ *   intermediate values below 6p and a result below 2p, and a product of inputs below p is below 2p: in both cases a
+ *   single conditional subtraction brings the result back below p;
+ * - the external matrix multiplies inputs below p by coefficients summing to at most 16, so its outputs (plus a round
+ *   constant) stay below 17p, which the S-box accepts directly;
+ * - the internal rounds keep every element below p, and the state is fully reduced when entering and leaving them.
+ *
+ * Only compiled in when targeting a CPU with IFMA (e.g. TARGET_ARCH=icelake-server), and only used for parameters with
+ * t = 4 and a modulus below 2^254.
+ */
+template <typename Params> class Poseidon2PermutationIfma {
+  public:
+    static constexpr size_t LANES = 8;
+    static constexpr size_t t = Params::t;
+    static constexpr size_t rounds_f = Params::rounds_f;
+    static constexpr size_t rounds_p = Params::rounds_p;
+    static constexpr size_t NUM_ROUNDS = Params::rounds_f + Params::rounds_p;
+
+    using FF = typename Params::FF;
+    using State = std::array<FF, t>;
+
+    // The kernel relies on the 4x4 external matrix and on 4p fitting in 256 bits with room for the reductions
+    static constexpr bool is_supported = t == 4 && FF::modulus.data[3] < (uint64_t(1) << 62);
+
+    /**
+     * @brief Permutes the given states in place
+     */
+    static void permutation(std::span<State, LANES> states)
+    {
+        static_assert(is_supported);
+        const Constants& constants = get_constants();
+        std::array<Element, t> current_state;
+        load(states, current_state);
+
+        // Apply 1st linear layer
+        matrix_multiplication_external(current_state);
+
+        // First set of external rounds
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round(current_state, constants.round_constants[i]);
+        }
+
+        // Internal rounds
+        for (auto& element : current_state) {
+            reduce_fully(element);
+        }
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            internal_round(current_state, constants.round_constants[i][0]);
+        }
+
+        // Remaining external rounds
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round(current_state, constants.round_constants[i]);
+        }
+        for (auto& element : current_state) {
+            reduce_fully(element);
+        }
+        store(current_state, states);
+    }
+
+  private:
+    static constexpr size_t NUM_LIMBS = 5;
+    static constexpr size_t LIMB_BITS = 52;
+    static constexpr uint64_t LIMB_MASK = (uint64_t(1) << LIMB_BITS) - 1;
+
+    // A fixed number of vectors (std::array would drop the alignment attributes of __m512i)
+    template <size_t N> struct Vectors {
+        __m512i data[N];
+        __m512i& operator[](size_t i) { return data[i]; }
+        const __m512i& operator[](size_t i) const { return data[i]; }
+    };
+    // One field element per lane, as 52-bit limbs (least significant first)
+    using Element = Vectors<NUM_LIMBS>;
+    // A constant shared by all lanes
+    using Limbs = std::array<uint64_t, NUM_LIMBS>;
+
+    struct Constants {
+        // Multiples p, 2p, 4p, 8p of the modulus
+        std::array<Limbs, 4> modulus_multiples;
+        // -p^{-1} mod 2^52
+        uint64_t modulus_inverse;
+        std::array<std::array<Limbs, t>, NUM_ROUNDS> round_constants;
+        std::array<Limbs, t> internal_matrix_diagonal;
+        // Converts from R = 2^256 to R = 2^260 and back
+        FF to_lanes_factor;
+        FF from_lanes_factor;
+    };
+
+    static Limbs to_limbs(const uint256_t& value)
+    {
+        Limbs limbs;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            limbs[i] = static_cast<uint64_t>((value >> (i * LIMB_BITS)).data[0]) & LIMB_MASK;
+        }
+        return limbs;
+    }
+
+    static uint256_t from_limbs(const Limbs& limbs)
+    {
+        uint256_t value = 0;
+        for (size_t i = NUM_LIMBS; i > 0; --i) {
+            value = (value << LIMB_BITS) + uint256_t(limbs[i - 1]);
+        }
+        return value;
+    }
+
+    static Limbs to_montgomery_limbs(const FF& element, const FF& to_lanes_factor)
+    {
+        const FF converted = (element * to_lanes_factor).reduce_once();
+        return to_limbs(uint256_t(converted.data[0], converted.data[1], converted.data[2], converted.data[3]));
+    }
+
+    static const Constants& get_constants()
+    {
+        static const Constants constants = []() {
+            Constants result;
+            // The internal representation of FF is x * 2^256, and we want x * 2^260
+            result.to_lanes_factor = FF(16);
+            result.from_lanes_factor = FF(16).invert();
+            // 8p does not fit in a uint256_t, so the multiples are doubled limb by limb
+            result.modulus_multiples[0] = to_limbs(FF::modulus);
+            for (size_t i = 1; i < 4; ++i) {
+                uint64_t carry = 0;
+                for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                    const uint64_t doubled = (result.modulus_multiples[i - 1][k] << 1) + carry;
+                    result.modulus_multiples[i][k] = doubled & LIMB_MASK;
+                    carry = doubled >> LIMB_BITS;
+                }
+            }
+            const uint64_t p0 = FF::modulus.data[0];
+            uint64_t inverse = p0;
+            for (size_t i = 0; i < 5; ++i) {
+                inverse *= 2 - p0 * inverse;
+            }
+            result.modulus_inverse = (0 - inverse) & LIMB_MASK;
+            for (size_t i = 0; i < NUM_ROUNDS; ++i) {
+                for (size_t j = 0; j < t; ++j) {
+                    result.round_constants[i][j] =
+                        to_montgomery_limbs(Params::round_constants[i][j], result.to_lanes_factor);
+                }
+            }
+            for (size_t j = 0; j < t; ++j) {
+                result.internal_matrix_diagonal[j] =
+                    to_montgomery_limbs(Params::internal_matrix_diagonal[j], result.to_lanes_factor);
+            }
+            return result;
+        }();
+        return constants;
+    }
+
+    static void load(std::span<const State, LANES> states, std::array<Element, t>& elements)
+    {
+        const FF& factor = get_constants().to_lanes_factor;
+        for (size_t i = 0; i < t; ++i) {
+            alignas(64) std::array<std::array<uint64_t, LANES>, NUM_LIMBS> limbs;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                const Limbs lane_limbs = to_montgomery_limbs(states[lane][i], factor);
+                for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                    limbs[k][lane] = lane_limbs[k];
+                }
+            }
+            for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                elements[i][k] = _mm512_load_si512(limbs[k].data());
+            }
+        }
+    }
+
+    static void store(const std::array<Element, t>& elements, std::span<State, LANES> states)
+    {
+        const FF& factor = get_constants().from_lanes_factor;
+        for (size_t i = 0; i < t; ++i) {
+            alignas(64) std::array<std::array<uint64_t, LANES>, NUM_LIMBS> limbs;
+            for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                _mm512_store_si512(limbs[k].data(), elements[i][k]);
+            }
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                Limbs lane_limbs;
+                for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                    lane_limbs[k] = limbs[k][lane];
+                }
+                const uint256_t value = from_limbs(lane_limbs);
+                FF element;
+                element.data[0] = value.data[0];
+                element.data[1] = value.data[1];
+                element.data[2] = value.data[2];
+                element.data[3] = value.data[3];
+                states[lane][i] = element * factor;
+            }
+        }
+    }
+
+    static __m512i broadcast(uint64_t value) { return _mm512_set1_epi64(static_cast<int64_t>(value)); }
+
+    /**
+     * @brief Propagates the carries of limbs that have grown past 52 bits through additions
+     */
+    static void normalize(Element& element)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        for (size_t k = 0; k < NUM_LIMBS - 1; ++k) {
+            const __m512i carry = _mm512_srli_epi64(element[k], LIMB_BITS);
+            element[k] = _mm512_and_si512(element[k], mask);
+            element[k + 1] = _mm512_add_epi64(element[k + 1], carry);
+        }
+    }
+
+    /**
+     * @brief Adds without normalizing. Limbs have 12 bits of headroom, so a few additions can be chained.
+     */
+    static Element add(const Element& lhs, const Element& rhs)
+    {
+        Element result;
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            result[k] = _mm512_add_epi64(lhs[k], rhs[k]);
+        }
+        return result;
+    }
+
+    static void add_constant(Element& element, const Limbs& constant)
+    {
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            element[k] = _mm512_add_epi64(element[k], broadcast(constant[k]));
+        }
+        normalize(element);
+    }
+
+    /**
+     * @brief Subtracts the given multiple of the modulus from the lanes holding at least that much
+     */
+    static void conditional_subtract(Element& element, const Limbs& multiple)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        Element difference;
+        __m512i borrow = _mm512_setzero_si512();
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            difference[k] = _mm512_sub_epi64(_mm512_add_epi64(element[k], borrow), broadcast(multiple[k]));
+            borrow = _mm512_srai_epi64(difference[k], LIMB_BITS);
+            difference[k] = _mm512_and_si512(difference[k], mask);
+        }
+        // The final borrow is -1 in the lanes where the element is smaller than the multiple
+        const __mmask8 keep = _mm512_cmplt_epi64_mask(borrow, _mm512_setzero_si512());
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            element[k] = _mm512_mask_blend_epi64(keep, difference[k], element[k]);
+        }
+    }
+
+    /**
+     * @brief Reduces elements below 16p into [0, p)
+     */
+    static void reduce_fully(Element& element)
+    {
+        const auto& multiples = get_constants().modulus_multiples;
+        for (size_t i = multiples.size(); i > 0; --i) {
+            conditional_subtract(element, multiples[i - 1]);
+        }
+    }
+
+    /**
+     * @brief Montgomery multiplication (R = 2^260) of normalized elements, in the operand-scanning form. The result is
+     * normalized and below lhs * rhs / 2^260 + p.
+     */
+    static Element mul(const Element& lhs, const Element& rhs)
+    {
+        const Constants& constants = get_constants();
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i modulus_inverse = broadcast(constants.modulus_inverse);
+        Vectors<NUM_LIMBS> modulus;
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            modulus[k] = broadcast(constants.modulus_multiples[0][k]);
+        }
+
+        Vectors<NUM_LIMBS + 1> accumulator;
+        for (auto& limb : accumulator.data) {
+            limb = zero;
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                accumulator[k] = _mm512_madd52lo_epu64(accumulator[k], lhs[k], rhs[i]);
+                accumulator[k + 1] = _mm512_madd52hi_epu64(accumulator[k + 1], lhs[k], rhs[i]);
+            }
+            // Add the multiple of p that clears the lowest limb, then shift down by one limb
+            const __m512i m = _mm512_madd52lo_epu64(zero, accumulator[0], modulus_inverse);
+            for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                accumulator[k] = _mm512_madd52lo_epu64(accumulator[k], m, modulus[k]);
+                accumulator[k + 1] = _mm512_madd52hi_epu64(accumulator[k + 1], m, modulus[k]);
+            }
+            const __m512i carry = _mm512_srli_epi64(accumulator[0], LIMB_BITS);
+            accumulator[0] = _mm512_add_epi64(accumulator[1], carry);
+            for (size_t k = 1; k < NUM_LIMBS; ++k) {
+                accumulator[k] = accumulator[k + 1];
+            }
+            accumulator[NUM_LIMBS] = zero;
+        }
+
+        Element result;
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            result[k] = accumulator[k];
+        }
+        normalize(result);
+        return result;
+    }
+
+    /**
+     * @brief x^5 of an element below 17p, reduced into [0, p)
+     */
+    static void apply_single_sbox(Element& element)
+    {
+        const Element square = mul(element, element);
+        const Element quad = mul(square, square);
+        element = mul(quad, element);
+        conditional_subtract(element, get_constants().modulus_multiples[0]);
+    }
+
+    static void matrix_multiplication_external(std::array<Element, t>& input)
+    {
+        // The same addition chain as Poseidon2Permutation::matrix_multiplication_4x4
+        const Element t0 = add(input[0], input[1]);
+        const Element t1 = add(input[2], input[3]);
+        Element t2 = add(input[1], input[1]);
+        t2 = add(t2, t1);
+        Element t3 = add(input[3], input[3]);
+        t3 = add(t3, t0);
+        Element t4 = add(t1, t1);
+        t4 = add(t4, t4);
+        t4 = add(t4, t3);
+        Element t5 = add(t0, t0);
+        t5 = add(t5, t5);
+        t5 = add(t5, t2);
+        const Element t6 = add(t3, t5);
+        const Element t7 = add(t2, t4);
+        input[0] = t6;
+        input[1] = t5;
+        input[2] = t7;
+        input[3] = t4;
+        for (auto& element : input) {
+            normalize(element);
+        }
+    }
+
+    static void external_round(std::array<Element, t>& state, const std::array<Limbs, t>& round_constants)
+    {
+        for (size_t j = 0; j < t; ++j) {
+            add_constant(state[j], round_constants[j]);
+            apply_single_sbox(state[j]);
+        }
+        matrix_multiplication_external(state);
+    }
+
+    static void internal_round(std::array<Element, t>& state, const Limbs& round_constant)
+    {
+        const Constants& constants = get_constants();
+        add_constant(state[0], round_constant);
+        apply_single_sbox(state[0]);
+
+        Element sum = add(add(state[0], state[1]), add(state[2], state[3]));
+        normalize(sum);
+        conditional_subtract(sum, constants.modulus_multiples[1]);
+        conditional_subtract(sum, constants.modulus_multiples[0]);
+
+        for (size_t j = 0; j < t; ++j) {
+            Element diagonal;
+            for (size_t k = 0; k < NUM_LIMBS; ++k) {
+                diagonal[k] = broadcast(constants.internal_matrix_diagonal[j][k]);
+            }
+            state[j] = mul(state[j], diagonal);
+            conditional_subtract(state[j], constants.modulus_multiples[0]);
+            state[j] = add(state[j], sum);
+            normalize(state[j]);
+            conditional_subtract(state[j], constants.modulus_multiples[0]);
+        }
+    }
+};
+
+} // namespace bb::crypto
+
+#endif
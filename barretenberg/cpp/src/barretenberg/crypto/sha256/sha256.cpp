@@ -180,5 +180,6 @@ template Sha256Hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& inp
 template Sha256Hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 template Sha256Hash sha256<std::string>(const std::string& input);
 template Sha256Hash sha256<std::span<uint8_t>>(const std::span<uint8_t>& input);
+template Sha256Hash sha256<std::span<const uint8_t>>(const std::span<const uint8_t>& input);
 
 } // namespace bb::crypto
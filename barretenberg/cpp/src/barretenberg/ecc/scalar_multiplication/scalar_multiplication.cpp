@@ -3,7 +3,10 @@
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
@@ -957,6 +960,459 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * @brief Sum of `short_scalars[i] * points[2 * indices[i]]`, for scalars that fit into SHORT_SCALAR_BITS bits
+ *
+ * @details A plain bucket method without the endomorphism split: a short scalar only has a few windows, so each point
+ * is added into a few buckets instead of going through every round of the full pippenger. The window size is chosen
+ * per thread to balance the bucket additions against the cost of concatenating the buckets of each window.
+ */
+template <typename Curve>
+typename Curve::Element accumulate_short_scalars(const std::vector<uint32_t>& indices,
+                                                 const std::vector<uint32_t>& short_scalars,
+                                                 typename Curve::AffineElement* points)
+{
+    using Element = typename Curve::Element;
+    constexpr size_t MAX_WINDOW_BITS = 16;
+    constexpr size_t MIN_POINTS_PER_THREAD = 256;
+
+    const size_t num_threads =
+        std::min(get_num_cpus_pow2(), std::max<size_t>(indices.size() / MIN_POINTS_PER_THREAD, 1));
+    std::vector<Element> thread_accumulators(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = (indices.size() * thread_idx) / num_threads;
+        const size_t end = (indices.size() * (thread_idx + 1)) / num_threads;
+        Element& accumulator = thread_accumulators[thread_idx];
+        accumulator.self_set_infinity();
+
+        uint32_t scalar_bits = 0;
+        for (size_t i = start; i < end; ++i) {
+            scalar_bits |= short_scalars[i];
+        }
+        if (scalar_bits == 0) {
+            return;
+        }
+        const size_t num_scalar_bits = numeric::get_msb(scalar_bits) + 1;
+
+        // Each window costs one addition per point plus two additions per bucket
+        const size_t num_points = end - start;
+        size_t window_bits = 1;
+        size_t min_cost = SIZE_MAX;
+        for (size_t bits = 1; bits <= std::min(num_scalar_bits, MAX_WINDOW_BITS); ++bits) {
+            const size_t num_windows = (num_scalar_bits + bits - 1) / bits;
+            const size_t cost = num_windows * (num_points + (2UL << bits));
+            if (cost < min_cost) {
+                min_cost = cost;
+                window_bits = bits;
+            }
+        }
+        const size_t num_windows = (num_scalar_bits + window_bits - 1) / window_bits;
+        const size_t num_window_buckets = 1UL << window_bits;
+        const auto window_mask = static_cast<uint32_t>(num_window_buckets - 1);
+
+        std::vector<Element> buckets(num_windows * num_window_buckets);
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        for (size_t i = start; i < end; ++i) {
+            const uint32_t scalar = short_scalars[i];
+            for (size_t window = 0; window < num_windows; ++window) {
+                const uint32_t digit = (scalar >> (window * window_bits)) & window_mask;
+                if (digit != 0) {
+                    buckets[window * num_window_buckets + digit] += points[static_cast<size_t>(indices[i]) * 2];
+                }
+            }
+        }
+
+        // Concatenate the buckets of each window, starting with the most significant one
+        for (size_t window = num_windows; window > 0; --window) {
+            for (size_t k = 0; k < window_bits; ++k) {
+                accumulator.self_dbl();
+            }
+            Element running_sum;
+            running_sum.self_set_infinity();
+            Element window_sum;
+            window_sum.self_set_infinity();
+            const Element* window_buckets = &buckets[(window - 1) * num_window_buckets];
+            for (size_t digit = num_window_buckets - 1; digit > 0; --digit) {
+                running_sum += window_buckets[digit];
+                window_sum += running_sum;
+            }
+            accumulator += window_sum;
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& accumulator : thread_accumulators) {
+        result += accumulator;
+    }
+    return result;
+}
+
+/**
+ * @brief A multi-scalar-multiplication that only spends time on the non-trivial scalars
+ *
+ * @details Wire and selector polynomials are frequently mostly zero, or hold small values such as boolean selectors or
+ * range constrained limbs, but `pippenger` runs every scalar through all of its rounds. Here we first sort the scalars
+ * into four classes:
+ * - zero scalars are dropped (a zero check does not need a conversion out of Montgomery form);
+ * - scalars equal to one only need their point added to the result;
+ * - short scalars (below 2^SHORT_SCALAR_BITS) go through `accumulate_short_scalars`, which needs a handful of
+ *   additions per point;
+ * - the remaining dense scalars and their points are compacted into contiguous arrays and handed to `pippenger_unsafe`.
+ * The cost is therefore one cheap pass over the scalars plus work proportional to the number of non-zero scalars.
+ *
+ * @param scalars The scalars; left unmodified
+ * @param points The pippenger point table (see `generate_pippenger_point_table`)
+ * @param num_initial_points The number of scalars
+ * @param state A runtime state with room for at least `num_initial_points` points
+ */
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    struct ScalarClasses {
+        std::vector<uint32_t> one_indices;
+        std::vector<uint32_t> short_indices;
+        std::vector<uint32_t> short_scalars;
+        std::vector<uint32_t> dense_indices;
+    };
+
+    const size_t num_threads = get_num_cpus_pow2();
+    std::vector<ScalarClasses> thread_classes(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = (num_initial_points * thread_idx) / num_threads;
+        const size_t end = (num_initial_points * (thread_idx + 1)) / num_threads;
+        auto& classes = thread_classes[thread_idx];
+        const Fr one = Fr::one();
+        for (size_t i = start; i < end; ++i) {
+            const Fr& scalar = scalars[i];
+            if (scalar.is_zero()) {
+                continue;
+            }
+            if (scalar == one) {
+                classes.one_indices.emplace_back(static_cast<uint32_t>(i));
+                continue;
+            }
+            const Fr converted = scalar.from_montgomery_form();
+            if (converted.data[3] == 0 && converted.data[2] == 0 && converted.data[1] == 0 &&
+                (converted.data[0] >> SHORT_SCALAR_BITS) == 0) {
+                classes.short_indices.emplace_back(static_cast<uint32_t>(i));
+                classes.short_scalars.emplace_back(static_cast<uint32_t>(converted.data[0]));
+                continue;
+            }
+            classes.dense_indices.emplace_back(static_cast<uint32_t>(i));
+        }
+    });
+
+    size_t num_dense = 0;
+    for (const auto& thread_class : thread_classes) {
+        num_dense += thread_class.dense_indices.size();
+    }
+    // Nothing to filter out, skip the compaction
+    if (num_dense == num_initial_points) {
+        return pippenger_unsafe<Curve>(scalars, points, num_initial_points, state);
+    }
+
+    ScalarClasses classes;
+    for (auto& thread_class : thread_classes) {
+        classes.one_indices.insert(
+            classes.one_indices.end(), thread_class.one_indices.begin(), thread_class.one_indices.end());
+        classes.short_indices.insert(
+            classes.short_indices.end(), thread_class.short_indices.begin(), thread_class.short_indices.end());
+        classes.short_scalars.insert(
+            classes.short_scalars.end(), thread_class.short_scalars.begin(), thread_class.short_scalars.end());
+        classes.dense_indices.insert(
+            classes.dense_indices.end(), thread_class.dense_indices.begin(), thread_class.dense_indices.end());
+    }
+
+    Element result;
+    result.self_set_infinity();
+
+    if (!classes.one_indices.empty()) {
+        const auto& one_indices = classes.one_indices;
+        const size_t num_sum_threads = std::min(num_threads, one_indices.size());
+        std::vector<Element> thread_sums(num_sum_threads);
+        parallel_for(num_sum_threads, [&](size_t thread_idx) {
+            const size_t start = (one_indices.size() * thread_idx) / num_sum_threads;
+            const size_t end = (one_indices.size() * (thread_idx + 1)) / num_sum_threads;
+            thread_sums[thread_idx].self_set_infinity();
+            for (size_t i = start; i < end; ++i) {
+                thread_sums[thread_idx] += points[static_cast<size_t>(one_indices[i]) * 2];
+            }
+        });
+        for (const auto& sum : thread_sums) {
+            result += sum;
+        }
+    }
+
+    if (!classes.short_indices.empty()) {
+        result += accumulate_short_scalars<Curve>(classes.short_indices, classes.short_scalars, points);
+    }
+
+    if (num_dense > 0) {
+        // The compacted point table keeps the {P, endo(P)} layout expected by pippenger
+        std::vector<Fr> dense_scalars(num_dense);
+        auto dense_points = point_table_alloc<AffineElement>(num_dense);
+        run_loop_in_parallel(num_dense, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                const size_t index = classes.dense_indices[i];
+                dense_scalars[i] = scalars[index];
+                dense_points[2 * i] = points[2 * index];
+                dense_points[2 * i + 1] = points[2 * index + 1];
+            }
+        });
+        result += pippenger_unsafe<Curve>(dense_scalars.data(), dense_points.get(), num_dense, state);
+    }
+    return result;
+}
+
+/**
+ * @brief Compute several multi-scalar-multiplications against the same point table in one pass
+ *
+ * @details Calling `pippenger` once per scalar vector repeats the wnaf computation, the bucket sort and the thread
+ * spin-up for every MSM, and for small MSMs each round does not have enough work to keep all threads busy. Here we
+ * treat the k MSMs as a single MSM with k * num_buckets buckets: the wnaf entries of the p-th MSM are tagged with bucket
+ * indices offset by p * num_buckets, so a single radix sort per round interleaves all the MSMs and the affine bucket
+ * accumulation (with its batched inversions) runs over all of them at once. When evaluating a thread's range of
+ * buckets we split it at MSM boundaries and accumulate the bucket sums into per-MSM accumulators.
+ *
+ * All scalar vectors index the same prefix of `points` (a pippenger point table). The incomplete addition formulae
+ * are used, with the same caveats as `pippenger_unsafe`: the points in each bucket must be distinct.
+ *
+ * @param scalar_sets k scalar vectors, each no longer than the point table. They may differ in size.
+ * @param points The pippenger point table (see `generate_pippenger_point_table`)
+ * @return The k MSM results, in the order of `scalar_sets`
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_unsafe_batch(
+    std::span<const std::span<const typename Curve::ScalarField>> scalar_sets, typename Curve::AffineElement* points)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_msms = scalar_sets.size();
+    std::vector<Element> results(num_msms);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+
+    size_t max_num_initial_points = 0;
+    std::vector<size_t> msm_offsets(num_msms + 1, 0);
+    for (size_t p = 0; p < num_msms; ++p) {
+        max_num_initial_points = std::max(max_num_initial_points, scalar_sets[p].size());
+        msm_offsets[p + 1] = msm_offsets[p] + 2 * scalar_sets[p].size();
+    }
+    const size_t num_points = msm_offsets[num_msms];
+    if (num_points == 0) {
+        return results;
+    }
+
+    // The bucket width (and therefore the number of rounds) is chosen for the largest MSM, so that every MSM uses the
+    // same wnaf decomposition.
+    const size_t bits_per_bucket = get_optimal_bucket_width(max_num_initial_points);
+    const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+    const size_t num_buckets_per_msm = 1UL << bits_per_bucket;
+    const size_t num_buckets = num_buckets_per_msm * num_msms;
+    // The radix sort must not reach the sign bit (bit 31) of a wnaf entry, see `process_buckets`.
+    const auto bucket_bits = static_cast<uint32_t>(numeric::get_msb(static_cast<uint64_t>(num_buckets - 1)) + 1);
+    ASSERT(bucket_bits + 1 <= 24);
+
+    const size_t num_threads = get_num_cpus_pow2();
+    constexpr size_t MAX_NUM_ROUNDS = pippenger_runtime_state<Curve>::MAX_NUM_ROUNDS;
+    std::vector<uint64_t> point_schedule(num_points * num_rounds + num_threads * 16);
+    std::unique_ptr<bool[]> skew_table(new bool[num_points]);
+    std::vector<std::array<uint64_t, MAX_NUM_ROUNDS>> thread_round_counts(num_threads);
+
+    // Compute the wnaf entries of every MSM. Each thread takes a slice of each scalar vector.
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& round_counts = thread_round_counts[thread_idx];
+        std::fill(round_counts.begin(), round_counts.end(), 0);
+        for (size_t p = 0; p < num_msms; ++p) {
+            const auto& scalars = scalar_sets[p];
+            const size_t start = (scalars.size() * thread_idx) / num_threads;
+            const size_t end = (scalars.size() * (thread_idx + 1)) / num_threads;
+            const uint64_t bucket_offset = p * num_buckets_per_msm;
+            for (size_t j = start; j < end; ++j) {
+                auto T0 = scalars[j].from_montgomery_form();
+                Curve::ScalarField::split_into_endomorphism_scalars(T0, T0, *(typename Curve::ScalarField*)&T0.data[2]);
+                for (size_t k = 0; k < 2; ++k) {
+                    const size_t schedule_idx = msm_offsets[p] + 2 * j + k;
+                    wnaf::fixed_wnaf_with_counts(&T0.data[2 * k],
+                                                 &point_schedule[schedule_idx],
+                                                 skew_table[schedule_idx],
+                                                 &round_counts[0],
+                                                 static_cast<uint64_t>(2 * j + k) << 32ULL,
+                                                 num_points,
+                                                 wnaf_bits);
+                    if (bucket_offset == 0) {
+                        continue;
+                    }
+                    for (size_t round = 0; round < num_rounds; ++round) {
+                        uint64_t& entry = point_schedule[round * num_points + schedule_idx];
+                        // Entries of zero scalars are all ones and must stay at the end of the sorted schedule
+                        if (entry != 0xffffffffffffffffULL) {
+                            entry += bucket_offset;
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    std::array<uint64_t, MAX_NUM_ROUNDS> round_counts{};
+    for (size_t i = 0; i < num_threads; ++i) {
+        for (size_t j = 0; j < num_rounds; ++j) {
+            round_counts[j] += thread_round_counts[i][j];
+        }
+    }
+
+    parallel_for(num_rounds, [&](size_t i) {
+        scalar_multiplication::process_buckets(&point_schedule[i * num_points], num_points, bucket_bits + 1);
+    });
+
+    // Per thread, per MSM accumulators
+    std::vector<Element> thread_accumulators(num_threads * num_msms);
+    parallel_for(num_threads, [&](size_t j) {
+        Element* accumulators = &thread_accumulators[j * num_msms];
+        for (size_t p = 0; p < num_msms; ++p) {
+            accumulators[p].self_set_infinity();
+        }
+
+        // Scratch space for `reduce_buckets`. A thread never processes more than its share of a round plus leftovers.
+        const size_t max_thread_points = (num_points / num_threads) + num_threads + 16;
+        std::vector<AffineElement> point_pairs_1(max_thread_points);
+        std::vector<AffineElement> point_pairs_2(max_thread_points);
+        std::vector<typename Curve::BaseField> scratch_space(max_thread_points);
+        std::vector<uint32_t> bucket_counts;
+        std::vector<uint32_t> bit_offsets(64);
+        std::unique_ptr<bool[]> bucket_empty_status;
+        size_t bucket_capacity = 0;
+        std::vector<Element> round_accumulators(num_msms);
+
+        for (size_t i = 0; i < num_rounds; ++i) {
+            for (auto& accumulator : round_accumulators) {
+                accumulator.self_set_infinity();
+            }
+            const uint64_t num_round_points = round_counts[i];
+            if (num_round_points != 0 && (num_round_points >= num_threads || j == num_threads - 1)) {
+                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+                const uint64_t leftovers =
+                    (j == num_threads - 1) ? num_round_points - (num_round_points_per_thread * num_threads) : 0;
+
+                uint64_t* thread_point_schedule = &point_schedule[(i * num_points) + j * num_round_points_per_thread];
+                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+                const size_t last_bucket =
+                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+                if (num_thread_buckets > bucket_capacity) {
+                    bucket_capacity = num_thread_buckets;
+                    bucket_counts.resize(bucket_capacity);
+                    bucket_empty_status.reset(new bool[bucket_capacity]);
+                }
+
+                affine_product_runtime_state<Curve> product_state;
+                product_state.points = points;
+                product_state.point_pairs_1 = point_pairs_1.data();
+                product_state.point_pairs_2 = point_pairs_2.data();
+                product_state.scratch_space = scratch_space.data();
+                product_state.bucket_counts = bucket_counts.data();
+                product_state.bit_offsets = bit_offsets.data();
+                product_state.bucket_empty_status = bucket_empty_status.get();
+                product_state.point_schedule = thread_point_schedule;
+                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+                AffineElement* output_buckets = reduce_buckets(product_state, true, false);
+
+                // Walk the thread's buckets from the top, one MSM segment at a time. Within a segment this is the
+                // same running-sum concatenation as in `evaluate_pippenger_rounds`.
+                size_t remaining_outputs = product_state.num_points;
+                size_t segment_last = last_bucket;
+                while (true) {
+                    const size_t msm_idx = segment_last / num_buckets_per_msm;
+                    const size_t msm_first_bucket = msm_idx * num_buckets_per_msm;
+                    const size_t segment_first = std::max(first_bucket, msm_first_bucket);
+
+                    Element running_sum;
+                    running_sum.self_set_infinity();
+                    Element accumulator;
+                    accumulator.self_set_infinity();
+                    for (size_t k = segment_last; k > segment_first; --k) {
+                        if (!product_state.bucket_empty_status[k - first_bucket]) {
+                            running_sum += output_buckets[--remaining_outputs];
+                        }
+                        accumulator += running_sum;
+                    }
+                    if (!product_state.bucket_empty_status[segment_first - first_bucket]) {
+                        running_sum += output_buckets[--remaining_outputs];
+                    }
+                    accumulator.self_dbl();
+                    accumulator += running_sum;
+
+                    // Scale `running_sum` up to the value of the segment's first bucket, relative to its MSM.
+                    const uint64_t multiplier = static_cast<uint64_t>(segment_first - msm_first_bucket) << 1UL;
+                    if (multiplier > 0) {
+                        Element rolling_accumulator;
+                        rolling_accumulator.self_set_infinity();
+                        for (size_t shift = numeric::get_msb(multiplier) + 1; shift > 0; --shift) {
+                            rolling_accumulator.self_dbl();
+                            if (((multiplier >> (shift - 1)) & 1) == 1) {
+                                rolling_accumulator += running_sum;
+                            }
+                        }
+                        accumulator += rolling_accumulator;
+                    }
+                    round_accumulators[msm_idx] += accumulator;
+
+                    if (segment_first == first_bucket) {
+                        break;
+                    }
+                    segment_last = segment_first - 1;
+                }
+            }
+
+            for (size_t p = 0; p < num_msms; ++p) {
+                if (i > 0) {
+                    for (size_t k = 0; k < wnaf_bits; ++k) {
+                        accumulators[p].self_dbl();
+                    }
+                }
+                accumulators[p] += round_accumulators[p];
+            }
+        }
+
+        // Skew correction: subtract the points whose scalar was even. Each thread takes a slice of every MSM.
+        for (size_t p = 0; p < num_msms; ++p) {
+            const size_t msm_num_points = msm_offsets[p + 1] - msm_offsets[p];
+            const size_t start = (msm_num_points * j) / num_threads;
+            const size_t end = (msm_num_points * (j + 1)) / num_threads;
+            const bool* msm_skew_table = &skew_table[msm_offsets[p]];
+            for (size_t k = start; k < end; ++k) {
+                if (msm_skew_table[k]) {
+                    accumulators[p] += -points[k];
+                }
+            }
+        }
+    });
+
+    for (size_t j = 0; j < num_threads; ++j) {
+        for (size_t p = 0; p < num_msms; ++p) {
+            results[p] += thread_accumulators[j * num_msms + p];
+        }
+    }
+    return results;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
@@ -1009,6 +1465,14 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_unsafe_sparse<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     curve::BN254::AffineElement* points,
+                                                                     const size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::Element> pippenger_unsafe_batch<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalar_sets, curve::BN254::AffineElement* points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1060,6 +1524,16 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_unsafe_sparse<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::Element> pippenger_unsafe_batch<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalar_sets,
+    curve::Grumpkin::AffineElement* points);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
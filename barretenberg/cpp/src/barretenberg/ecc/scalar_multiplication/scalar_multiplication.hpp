@@ -5,6 +5,8 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -170,6 +172,20 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+// Scalars below 2^SHORT_SCALAR_BITS are handled by `pippenger_unsafe_sparse` without the full pippenger rounds
+constexpr size_t SHORT_SCALAR_BITS = 32;
+
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state);
+
+// Computes one MSM per scalar vector against the same point table, sharing the bucket sort and thread fan-out
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_unsafe_batch(
+    std::span<const std::span<const typename Curve::ScalarField>> scalar_sets, typename Curve::AffineElement* points);
+
 // Explicit instantiation
 // BN254
 
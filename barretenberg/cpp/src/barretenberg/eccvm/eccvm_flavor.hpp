@@ -373,6 +373,7 @@ class ECCVMFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
         // Set all shifted polynomials based on their to-be-shifted counterpart
         void set_shifted()
         {
@@ -44,7 +44,7 @@ bool ECCVMTraceChecker::check(Builder& builder, numeric::RNG* engine_ptr)
         constexpr size_t NUM_SUBRELATIONS = result.size();
 
         for (size_t i = 0; i < num_rows; ++i) {
-            Relation::accumulate(result, polynomials.get_row(i), params, 1);
+            Relation::accumulate(result, polynomials.get_row_view(i), params, 1);
 
             bool x = true;
             for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
@@ -73,7 +73,7 @@ bool ECCVMTraceChecker::check(Builder& builder, numeric::RNG* engine_ptr)
         r = 0;
     }
     for (size_t i = 0; i < num_rows; ++i) {
-        LookupRelation::accumulate(lookup_result, polynomials.get_row(i), params, 1);
+        LookupRelation::accumulate(lookup_result, polynomials.get_row_view(i), params, 1);
     }
     for (auto r : lookup_result) {
         if (r != 0) {
@@ -3,6 +3,7 @@
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
 
 namespace bb {
@@ -137,9 +138,9 @@ class ECCVMMSMMBuilder {
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
         // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
+        // Each MSM reads from the point tables of its own scalar muls only (the table rows of msm `i` are indexed by
+        // pc values in [pc_values[i + 1], pc_values[i])), so MSMs can update their read counts concurrently.
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                 auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
                 const auto& msm = msms[msm_idx];
@@ -182,7 +183,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -203,18 +204,21 @@ class ECCVMMSMMBuilder {
         std::span<Element> p1_trace(&points_to_normalize[0], num_point_adds_and_doubles);
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
-        // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling.
+        // (not a std::vector<bool>: MSMs write their entries concurrently, and neighbouring bits share a word)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
         // we start the accumulator at the point at infinity
         accumulator_trace[0] = (CycleGroup::affine_point_at_infinity);
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
-        // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        // operations.
+        // Every MSM starts from the point at infinity and owns the rows [msm_row_counts[i], msm_row_counts[i + 1]) and
+        // the trace entries [(msm_row_counts[i] - 1) * 4, (msm_row_counts[i + 1] - 1) * 4), so we build the MSMs in
+        // parallel. The rounds of a single MSM remain sequential as each one doubles the accumulator of the last.
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             Element accumulator = CycleGroup::affine_point_at_infinity;
             const auto& msm = msms[msm_idx];
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -269,7 +273,7 @@ class ECCVMMSMMBuilder {
                         p1_trace[trace_index] = p1;
                         p2_trace[trace_index] = p2;
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = false;
+                        operation_trace[trace_index] = 0;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -303,7 +307,7 @@ class ECCVMMSMMBuilder {
                         p2_trace[trace_index] = accumulator;
                         accumulator = accumulator.dbl();
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = true;
+                        operation_trace[trace_index] = 1;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -333,7 +337,7 @@ class ECCVMMSMMBuilder {
                             p1_trace[trace_index] = p1;
                             p2_trace[trace_index] = add_state.point;
                             p3_trace[trace_index] = accumulator;
-                            operation_trace[trace_index] = false;
+                            operation_trace[trace_index] = 0;
                             trace_index++;
                         }
                         row.q_add = false;
@@ -348,7 +352,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
         run_loop_in_parallel(points_to_normalize.size(), [&](size_t start, size_t end) {
@@ -356,10 +360,11 @@ class ECCVMMSMMBuilder {
         });
 
         // inverse_trace is used to compute the value of the `collision_inverse` column in the ECCVM.
+        // Each thread batch-inverts its own chunk, trading one extra inversion per thread for a parallel batch inversion
         std::vector<FF> inverse_trace(num_point_adds_and_doubles);
         run_loop_in_parallel(num_point_adds_and_doubles, [&](size_t start, size_t end) {
             for (size_t operation_idx = start; operation_idx < end; ++operation_idx) {
-                if (operation_trace[operation_idx]) {
+                if (operation_trace[operation_idx] != 0) {
                     inverse_trace[operation_idx] = (p1_trace[operation_idx].y + p1_trace[operation_idx].y);
                 } else {
                     inverse_trace[operation_idx] = (p2_trace[operation_idx].x - p1_trace[operation_idx].x);
@@ -371,7 +376,8 @@ class ECCVMMSMMBuilder {
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        // As in step 1, the rows of each MSM are filled independently.
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             const auto& msm = msms[msm_idx];
             size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -448,7 +454,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
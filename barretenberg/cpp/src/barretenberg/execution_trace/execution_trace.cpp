@@ -40,6 +40,7 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(TraceData&
             pkey_selector = trace_selector.share();
         }
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
+        proving_key.active_row_ranges = trace_data.active_row_ranges;
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
@@ -74,29 +75,42 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
                                                                                           size_t dyadic_circuit_size,
                                                                                           bool is_structured)
 {
-    TraceData trace_data{ dyadic_circuit_size, builder };
+    TraceData trace_data{ dyadic_circuit_size };
 
     // Complete the public inputs execution trace block from builder.public_inputs
     populate_public_inputs_block(builder);
 
+    // The wire addresses of the trace in row/column order, along with the real variable (i.e. copy cycle) of each
+    size_t num_nodes = 0;
+    for (auto& block : builder.blocks.get()) {
+        num_nodes += block.size() * NUM_WIRES;
+    }
+    std::vector<cycle_node> nodes(num_nodes);
+    std::vector<uint32_t> node_cycles(num_nodes);
+    size_t block_nodes_offset = 0;
+
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
     // For each block in the trace, populate wire polys, copy cycles and selector polys
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
 
-        // Update wire polynomials and copy cycles
+        // Update wire polynomials and copy cycle nodes; each row writes to its own entries so rows are done in parallel
         // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                uint32_t trace_row_idx = block_row_idx + offset;
-                // Insert the real witness values from this block into the wire polys at the correct offset
-                trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
-                // Add the address of the witness value to its corresponding copy cycle
-                trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+        run_loop_in_parallel(block_size, [&](size_t start, size_t end) {
+            for (auto block_row_idx = static_cast<uint32_t>(start); block_row_idx < end; ++block_row_idx) {
+                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
+                    uint32_t trace_row_idx = block_row_idx + offset;
+                    // Insert the real witness values from this block into the wire polys at the correct offset
+                    trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
+                    // Record the address of the witness value and the copy cycle it belongs to
+                    const size_t node_idx = block_nodes_offset + block_row_idx * NUM_WIRES + wire_idx;
+                    nodes[node_idx] = cycle_node{ wire_idx, trace_row_idx };
+                    node_cycles[node_idx] = builder.variable_classes[var_idx];
+                }
             }
-        }
+        });
+        block_nodes_offset += block_size * NUM_WIRES;
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
@@ -116,6 +130,10 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             trace_data.pub_inputs_offset = offset;
         }
 
+        if (block_size > 0) {
+            trace_data.active_row_ranges.emplace_back(offset, offset + block_size);
+        }
+
         // If the trace is structured, we populate the data from the next block at a fixed block size offset
         if (is_structured) {
             offset += block.get_fixed_size();
@@ -123,6 +141,9 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             offset += block_size;
         }
     }
+
+    // Group the nodes into copy cycles, keeping the row/column order within each cycle
+    trace_data.copy_cycles = CopyCycles(builder.variables.size(), node_cycles, nodes);
     return trace_data;
 }
 
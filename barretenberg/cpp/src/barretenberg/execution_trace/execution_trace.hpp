@@ -19,12 +19,14 @@ template <class Flavor> class ExecutionTrace_ {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, Builder::Arithmetization::NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // The sets of addresses into the wire polynomials whose values are copy constrained, one per variable
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
+        // Ranges [start, end) of the rows occupied by the gates of each non-empty block
+        std::vector<std::pair<size_t, size_t>> active_row_ranges;
 
-        TraceData(size_t dyadic_circuit_size, Builder& builder)
+        TraceData(size_t dyadic_circuit_size)
         {
             // Initializate the wire and selector polynomials
             for (auto& wire : wires) {
@@ -33,7 +35,6 @@ template <class Flavor> class ExecutionTrace_ {
             for (auto& selector : selectors) {
                 selector = Polynomial(dyadic_circuit_size);
             }
-            copy_cycles.resize(builder.variables.size());
         }
     };
 
@@ -115,10 +115,21 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // folded element by element.
     std::vector<FF> public_inputs;
 
+    // Ranges [start, end) of rows containing gates, lookup tables or other non-trivial data. Outside of these rows
+    // (e.g. the padding of a structured trace) every relation vanishes identically. Empty if unknown.
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     ProvingKey_() = default;
-    ProvingKey_(const size_t circuit_size, const size_t num_public_inputs)
+    /**
+     * @param commitment_key An existing commitment key over at least circuit_size + 1 points, e.g. one kept alive
+     * across proofs by a long-lived prover. A new one is constructed from the global CRS if not provided.
+     */
+    ProvingKey_(const size_t circuit_size,
+                const size_t num_public_inputs,
+                std::shared_ptr<CommitmentKey_> commitment_key = nullptr)
     {
-        this->commitment_key = std::make_shared<CommitmentKey_>(circuit_size + 1);
+        this->commitment_key =
+            commitment_key ? std::move(commitment_key) : std::make_shared<CommitmentKey_>(circuit_size + 1);
         this->evaluation_domain = bb::EvaluationDomain<FF>(circuit_size, circuit_size);
         this->circuit_size = circuit_size;
         this->log_circuit_size = numeric::get_msb(circuit_size);
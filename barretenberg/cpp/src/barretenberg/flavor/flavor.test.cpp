@@ -85,3 +85,26 @@ TEST(Flavor, GetRow)
     EXPECT_EQ(row0.q_elliptic, prover_polynomials.q_elliptic[0]);
     EXPECT_EQ(row1.w_4_shift, prover_polynomials.w_4_shift[1]);
 }
+
+TEST(Flavor, GetRowView)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    std::array<std::vector<FF>, Flavor::NUM_ALL_ENTITIES> data;
+    std::generate(data.begin(), data.end(), []() {
+        return std::vector<FF>({ FF::random_element(), FF::random_element() });
+    });
+    Flavor::ProverPolynomials prover_polynomials;
+    for (auto [poly, entry] : zip_view(prover_polynomials.get_all(), data)) {
+        poly = entry;
+    }
+    for (size_t row_idx = 0; row_idx < 2; ++row_idx) {
+        auto row = prover_polynomials.get_row(row_idx);
+        auto row_view = prover_polynomials.get_row_view(row_idx);
+        for (auto [value, entry] : zip_view(row.get_all(), row_view.get_all())) {
+            EXPECT_EQ(value, entry);
+        }
+        // The view references the polynomials rather than copying them
+        EXPECT_EQ(&row_view.w_4_shift.get(), &prover_polynomials.w_4_shift[row_idx]);
+    }
+}
@@ -10,6 +10,7 @@
 #include "barretenberg/common/std_array.hpp"
 #include "barretenberg/common/std_string.hpp"
 #include "barretenberg/common/std_vector.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include <array>
 #include <iostream>
 #include <sstream>
@@ -37,6 +38,42 @@ template <typename T, typename... BaseClass> auto _concatenate_base_class_get_la
 }
 } // namespace bb::detail
 
+namespace bb {
+/**
+ * @brief A read-only reference to the value of a polynomial at some row, used as the DataType of row views
+ *
+ * @details Behaves like a `const FF&` in the expressions of relations: it converts to one, so that `View(in.w_l)`
+ * reads the polynomial in place, and supports the few operations relations apply to their inputs directly.
+ */
+template <typename FF> class RowEntry {
+  public:
+    RowEntry() = default;
+    explicit RowEntry(const FF& value)
+        : value_(&value)
+    {}
+
+    operator const FF&() const { return *value_; }
+    const FF& get() const { return *value_; }
+    bool is_zero() const { return value_->is_zero(); }
+
+    friend FF operator+(const RowEntry& lhs, const RowEntry& rhs) { return lhs.get() + rhs.get(); }
+    friend FF operator+(const RowEntry& lhs, const FF& rhs) { return lhs.get() + rhs; }
+    friend FF operator+(const FF& lhs, const RowEntry& rhs) { return lhs + rhs.get(); }
+    friend FF operator-(const RowEntry& lhs, const RowEntry& rhs) { return lhs.get() - rhs.get(); }
+    friend FF operator-(const RowEntry& lhs, const FF& rhs) { return lhs.get() - rhs; }
+    friend FF operator-(const FF& lhs, const RowEntry& rhs) { return lhs - rhs.get(); }
+    friend FF operator*(const RowEntry& lhs, const RowEntry& rhs) { return lhs.get() * rhs.get(); }
+    friend FF operator*(const RowEntry& lhs, const FF& rhs) { return lhs.get() * rhs; }
+    friend FF operator*(const FF& lhs, const RowEntry& rhs) { return lhs * rhs.get(); }
+    friend FF operator-(const RowEntry& entry) { return -entry.get(); }
+    friend bool operator==(const RowEntry& lhs, const RowEntry& rhs) { return lhs.get() == rhs.get(); }
+    friend bool operator==(const RowEntry& lhs, const FF& rhs) { return lhs.get() == rhs; }
+
+  private:
+    const FF* value_ = nullptr;
+};
+} // namespace bb
+
 #define DEFINE_REF_VIEW(...)                                                                                           \
     [[nodiscard]] auto get_all()                                                                                       \
     {                                                                                                                  \
@@ -83,3 +120,22 @@ template <typename T, typename... BaseClass> auto _concatenate_base_class_get_la
     {                                                                                                                  \
         return bb::detail::_concatenate_base_class_get_labels<decltype(*this), __VA_ARGS__>(*this);                    \
     }
+
+/**
+ * @brief Define a row view of a ProverPolynomials class: AllEntities over RowEntry, so with the same named members as
+ * AllValues, each referencing the corresponding polynomial at the row.
+ *
+ * @details `get_row_view(i)` is the zero-copy counterpart of `get_row(i)`: it only sets one pointer per polynomial, and
+ * relations read the entries they use (and no others) from the polynomials directly. The view must not outlive the
+ * polynomials.
+ */
+#define DEFINE_ROW_VIEW(AllEntitiesType, FF)                                                                           \
+    using RowView = AllEntitiesType<bb::RowEntry<FF>>;                                                                 \
+    [[nodiscard]] RowView get_row_view(const size_t row_idx) const                                                     \
+    {                                                                                                                  \
+        RowView view;                                                                                                  \
+        for (auto [entry, polynomial] : zip_view(view.get_all(), this->get_all())) {                                   \
+            entry = bb::RowEntry<FF>(polynomial[row_idx]);                                                             \
+        }                                                                                                              \
+        return view;                                                                                                   \
+    }
@@ -7,6 +7,7 @@
 #define ExtendedEdge(Flavor) Flavor::ExtendedEdges
 #define EvaluationEdge(Flavor) Flavor::AllValues
 #define EntityEdge(Flavor) Flavor::AllEntities<Flavor::FF>
+#define RowViewEdge(Flavor) Flavor::AllEntities<bb::RowEntry<Flavor::FF>>
 
 #define ACCUMULATE(...) _ACCUMULATE(__VA_ARGS__)
 #define _ACCUMULATE(RelationImpl, Flavor, AccumulatorType, EdgeType)                                                   \
@@ -26,7 +27,8 @@
 #define DEFINE_SUMCHECK_RELATION_CLASS(RelationImpl, Flavor)                                                           \
     ACCUMULATE(RelationImpl, Flavor, SumcheckTupleOfUnivariatesOverSubrelations, ExtendedEdge)                         \
     ACCUMULATE(RelationImpl, Flavor, SumcheckArrayOfValuesOverSubrelations, EvaluationEdge)                            \
-    ACCUMULATE(RelationImpl, Flavor, SumcheckArrayOfValuesOverSubrelations, EntityEdge)
+    ACCUMULATE(RelationImpl, Flavor, SumcheckArrayOfValuesOverSubrelations, EntityEdge)                                \
+    ACCUMULATE(RelationImpl, Flavor, SumcheckArrayOfValuesOverSubrelations, RowViewEdge)
 
 #define DEFINE_SUMCHECK_VERIFIER_RELATION_CLASS(RelationImpl, Flavor)                                                  \
     ACCUMULATE(RelationImpl, Flavor, SumcheckArrayOfValuesOverSubrelations, EvaluationEdge)
@@ -1,4 +1,7 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <span>
 #include <typeinfo>
 
 namespace bb {
@@ -29,33 +32,48 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
+    // Below this many rows per thread, the extra inversion per chunk is not worth the parallelism
+    constexpr size_t MIN_ROWS_PER_THREAD = 1 << 10;
 
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+
+    // Each thread computes the denominators of a contiguous chunk of rows and batch-inverts them in place, at the cost
+    // of one field inversion per chunk. Chunks without a single read or write (common in sparse VM traces) are left
+    // untouched.
+    const size_t num_threads = calculate_num_threads(circuit_size, MIN_ROWS_PER_THREAD);
+    const size_t rows_per_thread = (circuit_size + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * rows_per_thread;
+        const size_t end = std::min(start + rows_per_thread, circuit_size);
+        bool chunk_has_inverses = false;
+        for (size_t i = start; i < end; ++i) {
+            const auto row = polynomials.get_row_view(i);
+            bool has_inverse = lookup_relation.operation_exists_at_row(row);
+            if (!has_inverse) {
+                continue;
+            }
+            FF denominator = 1;
+            bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            inverse_polynomial[i] = denominator;
+            chunk_has_inverses = true;
+        }
+
+        // todo might be inverting zero in field bleh bleh
+        if (chunk_has_inverses) {
+            FF::batch_invert(std::span{ &inverse_polynomial[start], end - start });
         }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
-    };
-
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    });
 }
 
 /**
@@ -10,12 +10,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 
-#ifdef __wasm__
 #include "barretenberg/polynomials/polynomial_store_cache.hpp"
-// #include "barretenberg/polynomials/polynomial_store_wasm.hpp"
-#else
-#include "barretenberg/polynomials/polynomial_store.hpp"
-#endif
 
 namespace bb::plonk {
 
@@ -27,12 +22,7 @@ struct proving_key_data {
     std::vector<uint32_t> recursive_proof_public_input_indices;
     std::vector<uint32_t> memory_read_records;
     std::vector<uint32_t> memory_write_records;
-#ifdef __wasm__
     PolynomialStoreCache polynomial_store;
-    // PolynomialStoreWasm<bb::fr> polynomial_store;
-#else
-    PolynomialStore<bb::fr> polynomial_store;
-#endif
 };
 
 struct proving_key {
@@ -63,12 +53,8 @@ struct proving_key {
     std::vector<uint32_t> memory_read_records;  // Used by UltraPlonkComposer only; for ROM, RAM reads.
     std::vector<uint32_t> memory_write_records; // Used by UltraPlonkComposer only, for RAM writes.
 
-#ifdef __wasm__
+    // Natively, polynomials beyond the BB_POLYNOMIAL_STORE_BUDGET byte budget are spilled to memory-mapped files
     PolynomialStoreCache polynomial_store;
-    // PolynomialStoreWasm<bb::fr> polynomial_store;
-#else
-    PolynomialStore<bb::fr> polynomial_store;
-#endif
 
     bb::evaluation_domain small_domain;
     bb::evaluation_domain large_domain;
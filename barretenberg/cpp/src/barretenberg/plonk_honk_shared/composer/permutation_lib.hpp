@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -19,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -64,24 +67,83 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     PermutationMapping(size_t circuit_size)
     {
         for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
-            sigmas[col_idx].reserve(circuit_size);
+            sigmas[col_idx].resize(circuit_size);
             if constexpr (generalized) {
-                ids[col_idx].reserve(circuit_size);
+                ids[col_idx].resize(circuit_size);
             }
             // Initialize every element to point to itself
-            for (uint32_t row_idx = 0; row_idx < circuit_size; ++row_idx) {
-                permutation_subgroup_element self{ row_idx, col_idx };
-                sigmas[col_idx].emplace_back(self);
-                if constexpr (generalized) {
-                    ids[col_idx].emplace_back(self);
+            run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+                for (auto row_idx = static_cast<uint32_t>(start); row_idx < end; ++row_idx) {
+                    permutation_subgroup_element self{ row_idx, col_idx };
+                    sigmas[col_idx][row_idx] = self;
+                    if constexpr (generalized) {
+                        ids[col_idx][row_idx] = self;
+                    }
                 }
-            }
+            });
         }
     }
 };
 
 using CyclicPermutation = std::vector<cycle_node>;
 
+/**
+ * @brief The copy cycles of a circuit, stored back to back in a single array
+ *
+ * @details The nodes of cycle i are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1]. Compared to a vector of
+ * CyclicPermutation this needs two allocations instead of one per variable, and lets the cycles be split into ranges
+ * holding roughly the same number of nodes.
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets{ 0 };
+    std::vector<cycle_node> nodes;
+
+    CopyCycles() = default;
+
+    /**
+     * @brief Group nodes by cycle with a counting sort
+     *
+     * @param num_cycles The number of cycles, i.e. of variables in the circuit
+     * @param node_cycles The cycle of each node
+     * @param unsorted_nodes The nodes; within each cycle they keep the order they have here
+     */
+    CopyCycles(size_t num_cycles, std::span<const uint32_t> node_cycles, std::span<const cycle_node> unsorted_nodes)
+    {
+        ASSERT(node_cycles.size() == unsorted_nodes.size());
+        offsets.assign(num_cycles + 1, 0);
+        for (const uint32_t cycle : node_cycles) {
+            offsets[cycle + 1]++;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        nodes.resize(unsorted_nodes.size());
+        std::vector<size_t> next_position(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < unsorted_nodes.size(); ++i) {
+            nodes[next_position[node_cycles[i]]++] = unsorted_nodes[i];
+        }
+    }
+
+    size_t size() const { return offsets.size() - 1; }
+
+    std::span<const cycle_node> operator[](size_t cycle) const
+    {
+        return { nodes.data() + offsets[cycle], offsets[cycle + 1] - offsets[cycle] };
+    }
+
+    /**
+     * @brief The first cycle of the range handled by `thread_idx` out of `num_threads`, splitting the cycles into
+     * ranges with roughly the same number of nodes
+     */
+    size_t get_range_start(size_t thread_idx, size_t num_threads) const
+    {
+        if (thread_idx == num_threads) {
+            return size();
+        }
+        const size_t first_node = nodes.size() * thread_idx / num_threads;
+        return static_cast<size_t>(std::lower_bound(offsets.begin(), offsets.end() - 1, first_node) - offsets.begin());
+    }
+};
+
 namespace {
 /**
  * @brief Compute the traditional or generalized permutation mapping
@@ -99,7 +161,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    std::vector<CyclicPermutation> wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -108,44 +170,48 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
+    // Go through each cycle. Cycles write to disjoint entries of the mapping, so they are processed in parallel over
+    // ranges of cycles holding roughly the same number of nodes.
+    constexpr size_t MIN_NODES_PER_THREAD = 1 << 12;
+    const size_t num_threads = calculate_num_threads(wire_copy_cycles.nodes.size(), MIN_NODES_PER_THREAD);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = wire_copy_cycles.get_range_start(thread_idx, num_threads);
+        const size_t end = wire_copy_cycles.get_range_start(thread_idx + 1, num_threads);
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const auto copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                cycle_node current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+                        mapping.sigmas[current_column][current_row].row_index =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -368,7 +434,7 @@ inline std::tuple<Polynomial<FF>, Polynomial<FF>> compute_first_and_last_lagrang
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              std::vector<CyclicPermutation> copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
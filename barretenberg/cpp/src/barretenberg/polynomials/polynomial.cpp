@@ -91,6 +91,14 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     zero_memory_beyond(size_);
 }
 
+// external memory constructor
+template <typename Fr>
+Polynomial<Fr>::Polynomial(pointer backing_memory, size_t size)
+    : backing_memory_(std::move(backing_memory))
+    , coefficients_(backing_memory_.get())
+    , size_(size)
+{}
+
 // interpolation constructor
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<const Fr> evaluations)
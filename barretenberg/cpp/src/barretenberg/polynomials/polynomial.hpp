@@ -35,6 +35,10 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    // Wrap existing memory (e.g. a memory-mapped file) holding at least size + 1 elements, without copying. The
+    // memory is released through the deleter of backing_memory once the last share of the polynomial is gone.
+    Polynomial(pointer backing_memory, size_t size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
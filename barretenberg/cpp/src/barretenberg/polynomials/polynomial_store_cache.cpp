@@ -1,29 +1,92 @@
 #include "./polynomial_store_cache.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <cstdlib>
 
 namespace bb {
 
+#ifdef __wasm__
 PolynomialStoreCache::PolynomialStoreCache()
     : max_cache_size_(40)
 {}
+#else
+PolynomialStoreCache::PolynomialStoreCache()
+    : max_cache_size_(std::numeric_limits<size_t>::max())
+    , max_cache_bytes_(get_budget_from_env())
+{}
+
+size_t PolynomialStoreCache::get_budget_from_env()
+{
+    static const size_t budget = []() {
+        const char* value = std::getenv(BUDGET_ENV_VAR);
+        if (value == nullptr) {
+            return std::numeric_limits<size_t>::max();
+        }
+        char* end = nullptr;
+        const auto budget = std::strtoull(value, &end, 10);
+        if (end == value || *end != '\0') {
+            throw_or_abort(std::string(BUDGET_ENV_VAR) + " invalid.");
+        }
+        return static_cast<size_t>(budget);
+    }();
+    return budget;
+}
+#endif
 
 PolynomialStoreCache::PolynomialStoreCache(size_t max_cache_size)
     : max_cache_size_(max_cache_size)
 {}
 
+PolynomialStoreCache::PolynomialStoreCache(size_t max_cache_size, size_t max_cache_bytes, ExternalStore external_store)
+    : external_store(std::move(external_store))
+    , max_cache_size_(max_cache_size)
+    , max_cache_bytes_(max_cache_bytes)
+{}
+
+PolynomialStoreCache::PolynomialStoreCache(const PolynomialStoreCache& other)
+    : cache_(other.cache_)
+    , external_store(other.external_store)
+    , max_cache_size_(other.max_cache_size_)
+    , max_cache_bytes_(other.max_cache_bytes_)
+    , cache_bytes_(other.cache_bytes_)
+{
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+        size_map_.insert({ it->second.size(), it });
+    }
+}
+
+PolynomialStoreCache& PolynomialStoreCache::operator=(const PolynomialStoreCache& other)
+{
+    if (this != &other) {
+        *this = PolynomialStoreCache(other);
+    }
+    return *this;
+}
+
 void PolynomialStoreCache::put(std::string const& key, Polynomial&& value)
 {
     // info("cache put ", key);
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-        it->second = std::move(value);
+        // The new value may differ in size, so drop the old one rather than assigning over it
+        erase(it);
+    }
+#ifndef __wasm__
+    // Drop a copy of the key spilled earlier, rather than leave its file open behind the new value
+    external_store.remove(key);
+#endif
+
+    auto size = value.size();
+    const size_t num_bytes = size * sizeof(bb::fr);
+    if (num_bytes > max_cache_bytes_) {
+        external_store.put(key, std::move(value));
         return;
     }
 
-    purge_until_free();
+    purge_until_free(num_bytes);
 
-    auto size = value.size();
     auto [cache_it, _] = cache_.insert({ key, std::move(value) });
     size_map_.insert({ size, cache_it });
+    cache_bytes_ += num_bytes;
 };
 
 PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& key)
@@ -38,18 +101,33 @@ PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& ke
     return external_store.get(key);
 };
 
-void PolynomialStoreCache::purge_until_free()
+void PolynomialStoreCache::erase(std::map<std::string, Polynomial>::iterator cache_it)
+{
+    const size_t size = cache_it->second.size();
+    auto [begin, end] = size_map_.equal_range(size);
+    for (auto size_it = begin; size_it != end; ++size_it) {
+        if (size_it->second == cache_it) {
+            size_map_.erase(size_it);
+            break;
+        }
+    }
+    cache_bytes_ -= size * sizeof(bb::fr);
+    cache_.erase(cache_it);
+}
+
+void PolynomialStoreCache::purge_until_free(size_t num_bytes)
 {
-    while (cache_.size() >= max_cache_size_) {
+    while (!cache_.empty() && (cache_.size() >= max_cache_size_ || cache_bytes_ + num_bytes > max_cache_bytes_)) {
         auto size_it = size_map_.begin();
         auto [size, cache_it] = *size_it;
         auto key = cache_it->first;
         auto p = std::move(cache_it->second);
         size_map_.erase(size_it);
         cache_.erase(cache_it);
+        cache_bytes_ -= size * sizeof(bb::fr);
         // info("cache purging ", key, " size ", size);
         external_store.put(key, std::move(p));
     }
 }
 
-} // namespace bb
\ No newline at end of file
+} // namespace bb
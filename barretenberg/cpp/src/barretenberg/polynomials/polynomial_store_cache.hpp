@@ -1,6 +1,8 @@
 #pragma once
+#include "./polynomial_store_mmap.hpp"
 #include "./polynomial_store_wasm.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include <limits>
 #include <map>
 #include <string>
 
@@ -14,25 +16,65 @@ namespace bb {
  * In combination with the slab allocator, this brings us to about 4GB mem usage for 512k circuits.
  * In tests using just the external store increased proof time from by about 50%.
  * This pretty much recoups all losses.
+ *
+ * The cache can also be bounded by max_cache_bytes_, the resident-memory budget for cached coefficients; a polynomial
+ * larger than the whole budget goes straight to the external store. Natively the external store spills to
+ * memory-mapped files (see PolynomialStoreMmap), so the budget bounds the memory the store itself pins.
+ *
+ * Natively the default ctor sets no limit on the number of polynomials, and takes the byte budget from the
+ * BB_POLYNOMIAL_STORE_BUDGET environment variable (in bytes). Without it nothing is spilled, as with PolynomialStore.
  */
 class PolynomialStoreCache {
+  public:
+#ifdef __wasm__
+    using ExternalStore = PolynomialStoreWasm<bb::fr>;
+#else
+    using ExternalStore = PolynomialStoreMmap<bb::fr>;
+#endif
+
   private:
     using Polynomial = bb::Polynomial<bb::fr>;
     std::map<std::string, Polynomial> cache_;
     std::multimap<size_t, std::map<std::string, Polynomial>::iterator> size_map_;
-    PolynomialStoreWasm<bb::fr> external_store;
+    ExternalStore external_store;
     size_t max_cache_size_;
+    size_t max_cache_bytes_ = std::numeric_limits<size_t>::max();
+    size_t cache_bytes_ = 0;
 
   public:
+    static constexpr const char* BUDGET_ENV_VAR = "BB_POLYNOMIAL_STORE_BUDGET";
+
     PolynomialStoreCache();
     explicit PolynomialStoreCache(size_t max_cache_size_);
+    PolynomialStoreCache(size_t max_cache_size_,
+                         size_t max_cache_bytes_,
+                         ExternalStore external_store = ExternalStore());
+
+    // size_map_ points into cache_, so a copy has to rebuild it
+    PolynomialStoreCache(const PolynomialStoreCache& other);
+    PolynomialStoreCache(PolynomialStoreCache&& other) noexcept = default;
+    PolynomialStoreCache& operator=(const PolynomialStoreCache& other);
+    PolynomialStoreCache& operator=(PolynomialStoreCache&& other) noexcept = default;
+    ~PolynomialStoreCache() = default;
 
     void put(std::string const& key, Polynomial&& value);
 
     Polynomial get(std::string const& key);
 
+    size_t get_cache_bytes() const { return cache_bytes_; }
+
+#ifndef __wasm__
+    bool is_spilled(std::string const& key) const { return external_store.contains(key); }
+
+    /**
+     * @brief The byte budget set by BB_POLYNOMIAL_STORE_BUDGET, or no limit if it is not set
+     */
+    static size_t get_budget_from_env();
+#endif
+
   private:
-    void purge_until_free();
+    void erase(std::map<std::string, Polynomial>::iterator cache_it);
+    void purge_until_free(size_t num_bytes);
 };
 
-} // namespace bb
\ No newline at end of file
+} // namespace bb
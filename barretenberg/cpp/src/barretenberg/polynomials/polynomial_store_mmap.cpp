@@ -0,0 +1,100 @@
+#include "polynomial_store_mmap.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#ifndef __wasm__
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+template <typename Fr>
+PolynomialStoreMmap<Fr>::SpillFile::SpillFile(int fd, size_t size)
+    : fd(fd)
+    , size(size)
+{}
+
+template <typename Fr> PolynomialStoreMmap<Fr>::SpillFile::~SpillFile()
+{
+#ifndef __wasm__
+    close(fd);
+#endif
+}
+
+template <typename Fr>
+PolynomialStoreMmap<Fr>::PolynomialStoreMmap(std::string directory)
+    : directory(std::move(directory))
+{}
+
+template <typename Fr> std::string PolynomialStoreMmap<Fr>::default_directory()
+{
+#ifdef __wasm__
+    return "";
+#else
+    return std::filesystem::temp_directory_path().string();
+#endif
+}
+
+template <typename Fr> void PolynomialStoreMmap<Fr>::put(std::string const& key, Polynomial&& value)
+{
+#ifdef __wasm__
+    static_cast<void>(key);
+    static_cast<void>(value);
+    throw_or_abort("PolynomialStoreMmap is not available in wasm");
+#else
+    std::string path = directory + "/bb_polynomial_XXXXXX";
+    const int fd = mkstemp(path.data());
+    if (fd < 0) {
+        throw_or_abort("could not create a polynomial spill file in " + directory);
+    }
+    unlink(path.c_str());
+    auto file = std::make_shared<SpillFile>(fd, value.size());
+
+    // Extending the file to size + 1 coefficients provides the zero padding coefficient shifted polynomials read.
+    const auto* bytes = reinterpret_cast<const uint8_t*>(value.begin());
+    const size_t num_bytes = value.size() * sizeof(Fr);
+    if (ftruncate(fd, static_cast<off_t>(num_bytes + sizeof(Fr))) != 0) {
+        throw_or_abort("could not allocate polynomial spill file for " + key);
+    }
+    for (size_t written = 0; written < num_bytes;) {
+        const ssize_t result = pwrite(fd, bytes + written, num_bytes - written, static_cast<off_t>(written));
+        if (result <= 0) {
+            throw_or_abort("could not write polynomial spill file for " + key);
+        }
+        written += static_cast<size_t>(result);
+    }
+    // Nothing reads the file until a get; let the kernel write it back and reclaim its pages.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+
+    files[key] = std::move(file);
+    value = Polynomial();
+#endif
+}
+
+template <typename Fr> bb::Polynomial<Fr> PolynomialStoreMmap<Fr>::get(std::string const& key)
+{
+#ifdef __wasm__
+    static_cast<void>(key);
+    throw_or_abort("PolynomialStoreMmap is not available in wasm");
+#else
+    const auto& file = *files.at(key);
+    const size_t mapped_size = (file.size + 1) * sizeof(Fr);
+
+    // The mapping keeps the unlinked file alive after the store lets go of its descriptor.
+    void* mapping = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file.fd, 0);
+    if (mapping == MAP_FAILED) {
+        throw_or_abort("could not map polynomial spill file for " + key);
+    }
+    // Polynomials are mostly streamed front to back: read ahead aggressively and drop pages once they are behind us.
+    madvise(mapping, mapped_size, MADV_SEQUENTIAL);
+
+    auto unmap = [mapped_size](Fr* ptr) { munmap(ptr, mapped_size); };
+    return Polynomial(std::shared_ptr<Fr[]>(static_cast<Fr*>(mapping), unmap), file.size);
+#endif
+}
+
+template class PolynomialStoreMmap<bb::fr>;
+
+} // namespace bb
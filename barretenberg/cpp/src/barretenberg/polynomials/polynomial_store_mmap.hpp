@@ -0,0 +1,55 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace bb {
+
+/**
+ * @brief A native external polynomial store that spills polynomials to disk and hands them back as memory-mapped
+ * views.
+ *
+ * @details Each put writes the coefficients (plus the zero padding coefficient shifted polynomials rely on) to its own
+ * temporary file in `directory`. The file is unlinked as soon as it is created, so it only lives as long as the store
+ * and the polynomials returned from it, even if the process is killed. A get maps the file privately (copy-on-write):
+ * no data is copied, the kernel pages coefficients in as they are touched and may drop clean pages again under memory
+ * pressure, and writes through the returned polynomial never reach the store. Copies of the store share the spilled
+ * files, and polynomials obtained from a get remain valid after the key is overwritten or the store is destroyed.
+ *
+ * Spilled files are only as out-of-core as the file system under `directory`; pick a disk-backed one (not a tmpfs) to
+ * prove with proving keys larger than physical memory.
+ */
+template <typename Fr> class PolynomialStoreMmap {
+  private:
+    using Polynomial = bb::Polynomial<Fr>;
+
+    // An open descriptor of an unlinked spill file, closed when the last store copy referring to it goes away
+    struct SpillFile {
+        int fd;
+        size_t size;
+
+        SpillFile(int fd, size_t size);
+        SpillFile(const SpillFile&) = delete;
+        SpillFile& operator=(const SpillFile&) = delete;
+        ~SpillFile();
+    };
+
+    std::string directory;
+    std::unordered_map<std::string, std::shared_ptr<SpillFile>> files;
+
+  public:
+    explicit PolynomialStoreMmap(std::string directory = default_directory());
+
+    void put(std::string const& key, Polynomial&& value);
+
+    Polynomial get(std::string const& key);
+
+    bool contains(std::string const& key) const { return files.contains(key); }
+
+    void remove(std::string const& key) { files.erase(key); }
+
+    static std::string default_directory();
+};
+
+} // namespace bb
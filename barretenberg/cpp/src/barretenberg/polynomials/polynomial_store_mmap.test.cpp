@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "polynomial_store_cache.hpp"
+#include "polynomial_store_mmap.hpp"
+
+using namespace bb;
+
+namespace {
+Polynomial<fr> random_shiftable_polynomial(size_t size)
+{
+    Polynomial<fr> poly(size);
+    for (size_t i = 1; i < size; ++i) {
+        poly[i] = fr::random_element();
+    }
+    return poly;
+}
+} // namespace
+
+// A spilled polynomial is returned intact, including the padding its shift relies on
+TEST(PolynomialStoreMmap, PutThenGet)
+{
+    PolynomialStoreMmap<fr> polynomial_store;
+
+    auto poly = random_shiftable_polynomial(1024);
+    Polynomial<fr> poly_copy(poly);
+    polynomial_store.put("id", std::move(poly));
+
+    auto result = polynomial_store.get("id");
+    EXPECT_EQ(poly_copy, result);
+    EXPECT_EQ(poly_copy.shifted(), result.shifted());
+    EXPECT_TRUE(polynomial_store.contains("id"));
+
+    polynomial_store.remove("id");
+    EXPECT_FALSE(polynomial_store.contains("id"));
+    EXPECT_THROW(polynomial_store.get("id"), std::out_of_range);
+
+    // The mapping outlives the entry in the store
+    EXPECT_EQ(poly_copy, result);
+}
+
+// Writes through a returned polynomial do not reach the store, and overwriting a key leaves earlier views alone
+TEST(PolynomialStoreMmap, CopyOnWrite)
+{
+    PolynomialStoreMmap<fr> polynomial_store;
+
+    auto poly = random_shiftable_polynomial(100);
+    Polynomial<fr> poly_copy(poly);
+    polynomial_store.put("id", std::move(poly));
+
+    auto first = polynomial_store.get("id");
+    first[1] = 0;
+    EXPECT_EQ(poly_copy, polynomial_store.get("id"));
+
+    auto other = random_shiftable_polynomial(50);
+    Polynomial<fr> other_copy(other);
+    polynomial_store.put("id", std::move(other));
+    EXPECT_EQ(other_copy, polynomial_store.get("id"));
+    first[1] = poly_copy[1];
+    EXPECT_EQ(poly_copy, first);
+}
+
+// The cache keeps its resident coefficients within the byte budget and spills the rest
+TEST(PolynomialStoreCache, ResidentMemoryBudget)
+{
+    constexpr size_t SIZE = 256;
+    constexpr size_t NUM_POLYNOMIALS = 8;
+    PolynomialStoreCache polynomial_store(NUM_POLYNOMIALS, 3 * SIZE * sizeof(fr));
+
+    std::vector<Polynomial<fr>> expected;
+    for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+        auto poly = random_shiftable_polynomial(SIZE);
+        expected.emplace_back(poly);
+        polynomial_store.put(std::to_string(i), std::move(poly));
+        EXPECT_LE(polynomial_store.get_cache_bytes(), 3 * SIZE * sizeof(fr));
+    }
+    // Larger than the whole budget, so never cached
+    auto large = random_shiftable_polynomial(4 * SIZE);
+    Polynomial<fr> large_copy(large);
+    polynomial_store.put("large", std::move(large));
+
+    for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+        EXPECT_EQ(expected[i], polynomial_store.get(std::to_string(i)));
+    }
+    EXPECT_EQ(large_copy, polynomial_store.get("large"));
+
+    // Putting a spilled key again drops the spilled copy
+    EXPECT_TRUE(polynomial_store.is_spilled("0"));
+    polynomial_store.put("0", random_shiftable_polynomial(SIZE));
+    EXPECT_FALSE(polynomial_store.is_spilled("0"));
+
+    // Replacing a cached polynomial accounts for the new size
+    const size_t bytes_before = polynomial_store.get_cache_bytes();
+    polynomial_store.put(std::to_string(NUM_POLYNOMIALS - 1), random_shiftable_polynomial(SIZE / 2));
+    EXPECT_EQ(polynomial_store.get_cache_bytes(), bytes_before - SIZE / 2 * sizeof(fr));
+}
@@ -156,6 +156,44 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         }
     }
 
+    /**
+     * @brief Check that the block-wise computation of the full Honk relation at each row matches a direct evaluation of
+     * the relations row by row, over random polynomials whose size is not a multiple of the block size.
+     *
+     */
+    static void test_full_honk_evaluations_match_row_by_row()
+    {
+        using Utils = bb::RelationUtils<Flavor>;
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        const size_t instance_size = 3 * ProtoGalaxyProver::FULL_HONK_EVALUATION_BLOCK_SIZE + 5;
+        ProverPolynomials full_polynomials;
+        for (auto& poly : full_polynomials.get_all()) {
+            poly = bb::Polynomial<FF>::random(instance_size);
+        }
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+
+        std::vector<FF> expected_honk_evals(instance_size);
+        auto linearly_dependent_contribution = FF(0);
+        for (size_t row = 0; row < instance_size; row++) {
+            typename Flavor::TupleOfArraysOfValues relation_evaluations;
+            Utils::zero_elements(relation_evaluations);
+            Utils::template accumulate_relation_evaluations<>(
+                full_polynomials.get_row(row), relation_evaluations, relation_parameters, FF(1));
+            expected_honk_evals[row] = FF(0);
+            Utils::scale_and_batch_elements(
+                relation_evaluations, alphas, FF(1), expected_honk_evals[row], linearly_dependent_contribution);
+        }
+        expected_honk_evals[0] += linearly_dependent_contribution;
+
+        auto full_honk_evals =
+            ProtoGalaxyProver::compute_full_honk_evaluations(full_polynomials, alphas, relation_parameters);
+        EXPECT_EQ(full_honk_evals, expected_honk_evals);
+    }
+
     /**
      * @brief Check the coefficients of the perturbator computed from dummy \vec{β}, \vec{δ} and f_i(ω) will be the
      * same as if computed manually.
@@ -469,6 +507,11 @@ TYPED_TEST(ProtoGalaxyTests, FullHonkEvaluationsValidCircuit)
     TestFixture::test_full_honk_evaluations_valid_circuit();
 }
 
+TYPED_TEST(ProtoGalaxyTests, FullHonkEvaluationsMatchRowByRow)
+{
+    TestFixture::test_full_honk_evaluations_match_row_by_row();
+}
+
 TYPED_TEST(ProtoGalaxyTests, PerturbatorPolynomial)
 {
     TestFixture::test_pertubator_polynomial();
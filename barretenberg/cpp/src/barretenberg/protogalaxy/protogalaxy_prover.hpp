@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -36,6 +37,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     using RowEvaluations = typename Flavor::AllValues;
     using ProvingKey = typename Flavor::ProvingKey;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using RowView = typename ProverPolynomials::RowView;
     using Relations = typename Flavor::Relations;
     using RelationSeparator = typename Flavor::RelationSeparator;
     using CombinedRelationSeparator = typename ProverInstances::RelationSeparator;
@@ -72,6 +74,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     using RelationEvaluations = typename Flavor::TupleOfArraysOfValues;
 
     static constexpr size_t NUM_SUBRELATIONS = ProverInstances::NUM_SUBRELATIONS;
+    // Number of rows of the execution trace processed together by compute_full_honk_evaluations
+    static constexpr size_t FULL_HONK_EVALUATION_BLOCK_SIZE = 64;
 
     ProverInstances instances;
     std::shared_ptr<Transcript> transcript = std::make_shared<Transcript>();
@@ -151,52 +155,70 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * row. At the end of the function, the linearly dependent contribution is accumulated at index 0 representing the
      * sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the linearly dependent
      * subrelation and α_j is its corresponding batching challenge.
+     *
+     * The trace is processed in blocks of FULL_HONK_EVALUATION_BLOCK_SIZE rows. The rows of a block are read in place
+     * through row views, so each relation only reads the entries it uses, and each relation is evaluated over all rows
+     * of the block before moving on to the next one. Each thread accumulates the linearly dependent contribution of its
+     * own rows.
      */
     static std::vector<FF> compute_full_honk_evaluations(const ProverPolynomials& instance_polynomials,
                                                          const RelationSeparator& alpha,
                                                          const RelationParameters<FF>& relation_parameters)
     {
-        auto instance_size = instance_polynomials.get_polynomial_size();
+        constexpr size_t BLOCK_SIZE = FULL_HONK_EVALUATION_BLOCK_SIZE;
+        const size_t instance_size = instance_polynomials.get_polynomial_size();
+        const size_t num_blocks = (instance_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
         std::vector<FF> full_honk_evaluations(instance_size);
-        std::vector<FF> linearly_dependent_contributions(instance_size);
-#ifndef NO_MULTITHREADING
-        std::mutex evaluation_mutex;
-#endif
-        auto linearly_dependent_contribution_accumulator = FF(0);
-        run_loop_in_parallel(instance_size, [&](size_t start_row, size_t end_row) {
+
+        const size_t num_threads = calculate_num_threads(num_blocks);
+        const size_t blocks_per_thread = (num_blocks + num_threads - 1) / num_threads;
+        std::vector<FF> linearly_dependent_contributions(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            // Scratch space for the rows of a block, reused for all the blocks of this thread
+            std::vector<RowView> block_rows(BLOCK_SIZE);
+            std::vector<RelationEvaluations> block_relation_evaluations(BLOCK_SIZE);
             auto thread_accumulator = FF(0);
-            for (size_t row = start_row; row < end_row; row++) {
-                // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                auto row_evaluations = instance_polynomials.get_row(row);
-                RelationEvaluations relation_evaluations;
-                Utils::zero_elements(relation_evaluations);
-
-                // Note that the evaluations are accumulated with the gate separation challenge
-                // being 1 at this stage, as this specific randomness is added later through the
-                // power polynomial univariate specific to ProtoGalaxy
-                Utils::template accumulate_relation_evaluations<>(
-                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-                auto output = FF(0);
-                auto running_challenge = FF(1);
-
-                // Sum relation evaluations, batched by their corresponding relation separator challenge, to
-                // get the value of the full honk relation at a specific row
-                auto linearly_dependent_contribution = FF(0);
-                Utils::scale_and_batch_elements(
-                    relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
-                thread_accumulator += linearly_dependent_contribution;
-
-                full_honk_evaluations[row] = output;
-            }
-            {
-#ifndef NO_MULTITHREADING
-                std::unique_lock<std::mutex> evaluation_lock(evaluation_mutex);
-#endif
-                linearly_dependent_contribution_accumulator += thread_accumulator;
+
+            const size_t block_start = std::min(thread_idx * blocks_per_thread, num_blocks);
+            const size_t block_end = std::min(block_start + blocks_per_thread, num_blocks);
+            for (size_t block_idx = block_start; block_idx < block_end; ++block_idx) {
+                const size_t row_start = block_idx * BLOCK_SIZE;
+                const size_t num_rows = std::min(BLOCK_SIZE, instance_size - row_start);
+
+                for (size_t i = 0; i < num_rows; ++i) {
+                    block_rows[i] = instance_polynomials.get_row_view(row_start + i);
+                    Utils::zero_elements(block_relation_evaluations[i]);
+                }
+                // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage,
+                // as this specific randomness is added later through the power polynomial univariate specific to
+                // ProtoGalaxy
+                constexpr_for<0, Flavor::NUM_RELATIONS, 1>([&]<size_t relation_idx>() {
+                    for (size_t i = 0; i < num_rows; ++i) {
+                        Utils::template accumulate_relation_evaluation<RelationParameters<FF>, relation_idx>(
+                            block_rows[i], block_relation_evaluations[i], relation_parameters, FF(1));
+                    }
+                });
+
+                // Sum relation evaluations, batched by their corresponding relation separator challenge, to get the
+                // value of the full honk relation at each row
+                for (size_t i = 0; i < num_rows; ++i) {
+                    auto output = FF(0);
+                    auto running_challenge = FF(1);
+                    auto linearly_dependent_contribution = FF(0);
+                    Utils::scale_and_batch_elements(block_relation_evaluations[i],
+                                                    alpha,
+                                                    running_challenge,
+                                                    output,
+                                                    linearly_dependent_contribution);
+                    thread_accumulator += linearly_dependent_contribution;
+                    full_honk_evaluations[row_start + i] = output;
+                }
             }
+            linearly_dependent_contributions[thread_idx] = thread_accumulator;
         });
-        full_honk_evaluations[0] += linearly_dependent_contribution_accumulator;
+        for (const auto& contribution : linearly_dependent_contributions) {
+            full_honk_evaluations[0] += contribution;
+        }
         return full_honk_evaluations;
     }
 
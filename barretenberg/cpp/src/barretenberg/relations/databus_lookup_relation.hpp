@@ -3,6 +3,7 @@
 #include <tuple>
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/relations/relation_types.hpp"
@@ -193,28 +194,41 @@ template <typename FF_> class DatabusLookupRelationImpl {
                                               const size_t circuit_size)
     {
         auto& inverse_polynomial = BusData<bus_idx, Polynomials>::inverses(polynomials);
-        bool is_read = false;
-        bool nonzero_read_count = false;
-        for (size_t i = 0; i < circuit_size; ++i) {
-            // Determine if the present row contains a databus operation
-            auto& q_busread = polynomials.q_busread[i];
-            if constexpr (bus_idx == 0) { // calldata
-                is_read = q_busread == 1 && polynomials.q_l[i] == 1;
-                nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
+        // Rows are split into one contiguous chunk per thread, each batch-inverted in place (see the generic
+        // compute_logderivative_inverse in logderivative_library.hpp)
+        constexpr size_t MIN_ROWS_PER_THREAD = 1 << 10;
+        const size_t num_threads = calculate_num_threads(circuit_size, MIN_ROWS_PER_THREAD);
+        const size_t rows_per_thread = (circuit_size + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * rows_per_thread;
+            const size_t end = std::min(start + rows_per_thread, circuit_size);
+            bool is_read = false;
+            bool nonzero_read_count = false;
+            bool chunk_has_inverses = false;
+            for (size_t i = start; i < end; ++i) {
+                // Determine if the present row contains a databus operation
+                auto& q_busread = polynomials.q_busread[i];
+                if constexpr (bus_idx == 0) { // calldata
+                    is_read = q_busread == 1 && polynomials.q_l[i] == 1;
+                    nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
+                }
+                if constexpr (bus_idx == 1) { // return data
+                    is_read = q_busread == 1 && polynomials.q_r[i] == 1;
+                    nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
+                }
+                // We only compute the inverse if this row contains a read gate or data that has been read
+                if (is_read || nonzero_read_count) {
+                    const auto row = polynomials.get_row_view(i);
+                    inverse_polynomial[i] = compute_read_term<FF>(row, relation_parameters) *
+                                            compute_write_term<FF, bus_idx>(row, relation_parameters);
+                    chunk_has_inverses = true;
+                }
             }
-            if constexpr (bus_idx == 1) { // return data
-                is_read = q_busread == 1 && polynomials.q_r[i] == 1;
-                nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
+            // Compute inverse polynomial I in place by inverting the product at each row
+            if (chunk_has_inverses) {
+                FF::batch_invert(std::span{ &inverse_polynomial[start], end - start });
             }
-            // We only compute the inverse if this row contains a read gate or data that has been read
-            if (is_read || nonzero_read_count) {
-                auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                inverse_polynomial[i] = compute_read_term<FF>(row, relation_parameters) *
-                                        compute_write_term<FF, bus_idx>(row, relation_parameters);
-            }
-        }
-        // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial);
+        });
     };
 
     /**
@@ -149,7 +149,7 @@ template <typename Flavor> class RelationUtils {
      */
     template <typename Parameters, size_t relation_idx = 0>
     // TODO(#224)(Cody): Input should be an array?
-    inline static void accumulate_relation_evaluations_without_skipping(PolynomialEvaluations evaluations,
+    inline static void accumulate_relation_evaluations_without_skipping(const PolynomialEvaluations& evaluations,
                                                                         RelationEvaluations& relation_evaluations,
                                                                         const Parameters& relation_parameters,
                                                                         const FF& partial_evaluation_result)
@@ -175,12 +175,32 @@ template <typename Flavor> class RelationUtils {
      * relation. This value is checked against the final value of the target total sum (called sigma_0 in the
      * thesis).
      */
-    template <typename Parameters, size_t relation_idx = 0>
+    template <typename Parameters, size_t relation_idx = 0, typename Evaluations = PolynomialEvaluations>
     // TODO(#224)(Cody): Input should be an array?
-    inline static void accumulate_relation_evaluations(PolynomialEvaluations evaluations,
+    inline static void accumulate_relation_evaluations(const Evaluations& evaluations,
                                                        RelationEvaluations& relation_evaluations,
                                                        const Parameters& relation_parameters,
                                                        const FF& partial_evaluation_result)
+    {
+        accumulate_relation_evaluation<Parameters, relation_idx>(
+            evaluations, relation_evaluations, relation_parameters, partial_evaluation_result);
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            accumulate_relation_evaluations<Parameters, relation_idx + 1>(
+                evaluations, relation_evaluations, relation_parameters, partial_evaluation_result);
+        }
+    }
+
+    /**
+     * @brief Calculate the contribution of a single relation, skipping it if it is inactive on the given values
+     * @details The values are either an AllValues or a row view of the prover polynomials (see DEFINE_ROW_VIEW)
+     */
+    template <typename Parameters, size_t relation_idx, typename Evaluations = PolynomialEvaluations>
+    inline static void accumulate_relation_evaluation(const Evaluations& evaluations,
+                                                      RelationEvaluations& relation_evaluations,
+                                                      const Parameters& relation_parameters,
+                                                      const FF& partial_evaluation_result)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
 
@@ -200,12 +220,6 @@ template <typename Flavor> class RelationUtils {
                                      partial_evaluation_result);
             }
         }
-
-        // Repeat for the next relation.
-        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
-            accumulate_relation_evaluations<Parameters, relation_idx + 1>(
-                evaluations, relation_evaluations, relation_parameters, partial_evaluation_result);
-        }
     }
 
     /**
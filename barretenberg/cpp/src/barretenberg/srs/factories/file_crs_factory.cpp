@@ -6,9 +6,30 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/point_table_file.hpp"
 
 namespace bb::srs::factories {
 
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> load_pippenger_point_table(std::string const& path,
+                                                                           size_t num_points,
+                                                                           bool verify_checksum)
+{
+    const std::string table_path = PointTableFile<Curve>::get_path(path);
+    const uint64_t source_fingerprint = PointTableFile<Curve>::get_source_fingerprint(path);
+    if (auto table = PointTableFile<Curve>::map(table_path, num_points, source_fingerprint, verify_checksum)) {
+        return table;
+    }
+
+    auto table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+    srs::IO<Curve>::read_transcript_g1(table.get(), num_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+    if (!PointTableFile<Curve>::write(table_path, table.get(), num_points, source_fingerprint)) {
+        info("could not write pippenger point table to ", table_path);
+    }
+    return table;
+}
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
 {
@@ -30,9 +51,7 @@ FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    monomials_ = load_pippenger_point_table<Curve>(path, num_points, /*verify_checksum=*/true);
     first_g1 = monomials_[0];
 };
 
@@ -72,6 +91,11 @@ std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::g
     return verifier_crs_;
 }
 
+template std::shared_ptr<curve::BN254::AffineElement[]> load_pippenger_point_table<curve::BN254>(std::string const&,
+                                                                                                size_t,
+                                                                                                bool);
+template std::shared_ptr<curve::Grumpkin::AffineElement[]> load_pippenger_point_table<curve::Grumpkin>(
+    std::string const&, size_t, bool);
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
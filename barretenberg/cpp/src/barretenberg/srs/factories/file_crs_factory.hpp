@@ -10,6 +10,20 @@
 
 namespace bb::srs::factories {
 
+/**
+ * @brief Load the pippenger point table (SRS points interleaved with their endomorphism images) for `num_points`
+ * points of the transcript in `path`.
+ * @details Maps the pre-converted point table file in `path` if there is one large enough and built from the
+ * transcript currently in `path`. Otherwise reads the transcript, builds the table and tries to write it back so that
+ * subsequent processes can map it.
+ *
+ * @param verify_checksum Checksum the data of a mapped table, see `PointTableFile::map`
+ */
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> load_pippenger_point_table(std::string const& path,
+                                                                           size_t num_points,
+                                                                           bool verify_checksum = false);
+
 /**
  * Create reference strings given a path to a directory of transcript files.
  */
@@ -34,10 +48,7 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
     FileProverCrs(const size_t num_points, std::string const& path)
         : num_points(num_points)
     {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        monomials_ = load_pippenger_point_table<Curve>(path, num_points);
     };
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
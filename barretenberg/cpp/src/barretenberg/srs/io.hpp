@@ -136,11 +136,6 @@ template <typename Curve> class IO {
         file.close();
     }
 
-    static std::string get_transcript_path(std::string const& dir, size_t num)
-    {
-        return format(dir, "/monomial/transcript", (num < 10) ? "0" : "", std::to_string(num), ".dat");
-    };
-
     static bool is_file_exist(std::string const& fileName)
     {
         std::ifstream infile(fileName);
@@ -221,6 +216,11 @@ template <typename Curve> class IO {
     }
 
   public:
+    static std::string get_transcript_path(std::string const& dir, size_t num)
+    {
+        return format(dir, "/monomial/transcript", (num < 10) ? "0" : "", std::to_string(num), ".dat");
+    };
+
     template <typename AffineElementType> static void byteswap(AffineElementType* elements, size_t elements_size)
     {
         if constexpr (GivingG1AffineElementType<Curve, AffineElementType>) {
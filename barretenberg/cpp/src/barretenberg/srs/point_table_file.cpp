@@ -0,0 +1,160 @@
+#include "point_table_file.hpp"
+#include "io.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace bb::srs {
+
+namespace {
+uint64_t compute_header_checksum(PointTableFileHeader const& header)
+{
+    return point_table_checksum(reinterpret_cast<const uint8_t*>(&header),
+                                offsetof(PointTableFileHeader, header_checksum));
+}
+} // namespace
+
+template <typename Curve> uint64_t PointTableFile<Curve>::get_source_fingerprint(std::string const& dir)
+{
+    std::vector<uint64_t> file_stats;
+    std::error_code error;
+    for (size_t num = 0;; ++num) {
+        const std::string path = IO<Curve>::get_transcript_path(dir, num);
+        const auto size = std::filesystem::file_size(path, error);
+        if (error) {
+            break;
+        }
+        const auto mtime = std::filesystem::last_write_time(path, error);
+        if (error) {
+            break;
+        }
+        file_stats.push_back(static_cast<uint64_t>(size));
+        file_stats.push_back(static_cast<uint64_t>(mtime.time_since_epoch().count()));
+    }
+    return point_table_checksum(reinterpret_cast<const uint8_t*>(file_stats.data()),
+                                file_stats.size() * sizeof(uint64_t));
+}
+
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> PointTableFile<Curve>::map(std::string const& path,
+                                                                             size_t num_points,
+                                                                             uint64_t source_fingerprint,
+                                                                             bool verify_checksum)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    static_cast<void>(source_fingerprint);
+    static_cast<void>(verify_checksum);
+    return nullptr;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(PointTableFileHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+
+    // The mapping stays valid after the descriptor is closed.
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    auto unmap = [file_size](void* ptr) { munmap(ptr, file_size); };
+    std::unique_ptr<void, decltype(unmap)> guard(mapping, unmap);
+
+    PointTableFileHeader header;
+    std::memcpy(&header, mapping, sizeof(header));
+    const size_t table_size = sizeof(AffineElement) * 2 * header.num_points;
+    if (header.magic != POINT_TABLE_FILE_MAGIC || header.version != POINT_TABLE_FILE_VERSION ||
+        header.curve_id != curve_id() || header.header_checksum != compute_header_checksum(header) ||
+        file_size != sizeof(PointTableFileHeader) + table_size) {
+        info("ignoring malformed point table file at ", path);
+        return nullptr;
+    }
+    if (header.source_fingerprint != source_fingerprint) {
+        info("ignoring stale point table file at ", path);
+        return nullptr;
+    }
+    if (header.num_points < num_points) {
+        return nullptr;
+    }
+
+    auto* table_bytes = static_cast<uint8_t*>(mapping) + sizeof(PointTableFileHeader);
+    if (verify_checksum && point_table_checksum(table_bytes, table_size) != header.checksum) {
+        info("ignoring point table file with bad checksum at ", path);
+        return nullptr;
+    }
+
+    // We only touch the pages pippenger actually reads, and mostly at random.
+    madvise(mapping, file_size, MADV_RANDOM);
+
+    guard.release();
+    // Aliasing constructor: the control block owns (and unmaps) the whole mapping, the pointer refers to the table.
+    std::shared_ptr<void> owner(mapping, unmap);
+    return std::shared_ptr<AffineElement[]>(owner, reinterpret_cast<AffineElement*>(table_bytes));
+#endif
+}
+
+template <typename Curve>
+bool PointTableFile<Curve>::write(std::string const& path,
+                                  AffineElement const* table,
+                                  size_t num_points,
+                                  uint64_t source_fingerprint)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(table);
+    static_cast<void>(num_points);
+    static_cast<void>(source_fingerprint);
+    return false;
+#else
+    const size_t table_size = sizeof(AffineElement) * 2 * num_points;
+    const auto* table_bytes = reinterpret_cast<const uint8_t*>(table);
+
+    PointTableFileHeader header{};
+    header.magic = POINT_TABLE_FILE_MAGIC;
+    header.version = POINT_TABLE_FILE_VERSION;
+    header.curve_id = curve_id();
+    header.num_points = num_points;
+    header.checksum = point_table_checksum(table_bytes, table_size);
+    header.source_fingerprint = source_fingerprint;
+    header.header_checksum = compute_header_checksum(header);
+
+    const std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(table_bytes), static_cast<std::streamsize>(table_size));
+        if (!file) {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+#endif
+}
+
+template class PointTableFile<curve::BN254>;
+template class PointTableFile<curve::Grumpkin>;
+
+} // namespace bb::srs
@@ -0,0 +1,144 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace bb::srs {
+
+/**
+ * @brief Header of a pre-converted pippenger point table file
+ *
+ * @details The transcript files in `srs_db` store big-endian, non-Montgomery points, so every process that loads them
+ * has to byteswap, convert to Montgomery form and then run `generate_pippenger_point_table` to append the
+ * endomorphism points. A point table file stores the result of all of that, so that it can be mapped read-only
+ * straight into the address space of the prover. Many processes mapping the same file share one page-cache copy.
+ *
+ * A point table file has the following structure:
+ *
+ * 00   | magic                 | "BBPTABLE"
+ * 08   | version               | POINT_TABLE_FILE_VERSION
+ * 0C   | curve_id              | 0 for BN254, 1 for Grumpkin
+ * 10   | num_points            | The number of SRS points (the table holds 2 * num_points affine elements)
+ * 18   | checksum              | Checksum of the table data
+ * 20   | source_fingerprint    | Fingerprint of the transcript files the table was built from, see
+ *                                `PointTableFile::get_source_fingerprint`
+ * 28   | header_checksum       | Checksum of the bytes 00..28 of the header
+ * 30   | padding               | Pads the header to 64 bytes so that the table is cache-line aligned
+ * 40   | table                 | 2 * num_points native (little-endian, Montgomery form) affine elements, laid out as
+ *                                {P_0, endo(P_0), P_1, endo(P_1), ...}
+ *
+ * Because the table for n points is a prefix of the table for m >= n points, a single file serves every degree up to
+ * its num_points. A table whose source fingerprint does not match the transcript files next to it is stale (e.g. the
+ * SRS was replaced or extended) and is ignored.
+ */
+struct PointTableFileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t curve_id;
+    uint64_t num_points;
+    uint64_t checksum;
+    uint64_t source_fingerprint;
+    uint64_t header_checksum;
+    uint64_t padding[2];
+};
+static_assert(sizeof(PointTableFileHeader) == 64);
+
+static constexpr uint64_t POINT_TABLE_FILE_MAGIC = 0x454c424154504242ULL; // "BBPTABLE" read as little-endian
+// Bump whenever the layout or the in-memory field representation changes. Field elements are stored in their native
+// Montgomery representation, which differs between the int128 and the 32-bit (wasm) field implementations.
+#if defined(__SIZEOF_INT128__) && !defined(__wasm__)
+static constexpr uint32_t POINT_TABLE_FILE_VERSION = 2;
+#else
+static constexpr uint32_t POINT_TABLE_FILE_VERSION = 0x80000002;
+#endif
+
+/**
+ * @brief A cheap 64-bit checksum (FNV-1a over 64-bit words) used to detect truncated or corrupted table files.
+ */
+inline uint64_t point_table_checksum(const uint8_t* data, size_t size)
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Reads and writes pre-converted pippenger point tables
+ *
+ * @details `map` returns the table via a shared_ptr whose deleter unmaps the file, so it can be used anywhere a table
+ * returned by `scalar_multiplication::point_table_alloc` is expected. The mapping is private and copy-on-write: pages
+ * are shared between processes unless somebody writes to them.
+ */
+template <typename Curve> class PointTableFile {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    static constexpr uint32_t curve_id()
+    {
+        if constexpr (std::same_as<Curve, curve::BN254>) {
+            return 0;
+        } else {
+            static_assert(std::same_as<Curve, curve::Grumpkin>, "Unsupported curve for point table files");
+            return 1;
+        }
+    }
+
+    static std::string get_path(std::string const& dir)
+    {
+        return dir + (curve_id() == 0 ? "/pippenger_point_table_bn254.dat" : "/pippenger_point_table_grumpkin.dat");
+    }
+
+    /**
+     * @brief Fingerprint of the transcript files in `dir`, from the size and modification time of each of them
+     * @details Hashing the transcript contents would cost as much as reading them, which the point table file exists
+     * to avoid. Replacing, extending or truncating the transcripts changes the fingerprint.
+     */
+    static uint64_t get_source_fingerprint(std::string const& dir);
+
+    /**
+     * @brief Map the point table at `path` if it exists, is valid, was built from the transcripts with the given
+     * fingerprint and holds at least `num_points` points.
+     *
+     * @param verify_checksum Also checksum the table data. This touches every page of the file and therefore gives up
+     * the O(1) load time. Provers can skip it: the header checksum, the file size and the source fingerprint are
+     * always checked and the file is replaced atomically, so only corruption of the data at rest goes unnoticed, and a
+     * prover committing with corrupted points produces proofs that fail verification rather than unsound ones.
+     * Verifiers that read the table should verify it.
+     * @return The mapped table, or nullptr if the file is missing, stale, too small or malformed.
+     */
+    static std::shared_ptr<AffineElement[]> map(std::string const& path,
+                                                size_t num_points,
+                                                uint64_t source_fingerprint,
+                                                bool verify_checksum = false);
+
+    /**
+     * @brief Write the first `num_points` points of `table` (which must already be a pippenger point table, i.e. hold
+     * 2 * num_points elements) to `path`.
+     * @details The file is written to a temporary path and renamed into place, so concurrent readers never observe a
+     * partially written table.
+     * @return false if the file could not be written (e.g. the directory is read-only).
+     */
+    static bool write(std::string const& path,
+                      AffineElement const* table,
+                      size_t num_points,
+                      uint64_t source_fingerprint);
+};
+
+} // namespace bb::srs
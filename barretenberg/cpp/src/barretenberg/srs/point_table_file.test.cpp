@@ -0,0 +1,81 @@
+#include "point_table_file.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include "io.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+TEST(point_table_file, write_then_map_round_trip)
+{
+    const size_t num_points = 1024;
+    auto table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    srs::IO<curve::BN254>::read_transcript_g1(table.get(), num_points, "../srs_db/ignition");
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(table.get(), table.get(), num_points);
+
+    const std::string path = "point_table_file_test.dat";
+    const uint64_t source_fingerprint = 42;
+    ASSERT_TRUE(srs::PointTableFile<curve::BN254>::write(path, table.get(), num_points, source_fingerprint));
+
+    // A smaller table is a prefix of the larger one, a larger one must be rejected.
+    auto mapped =
+        srs::PointTableFile<curve::BN254>::map(path, num_points / 2, source_fingerprint, /*verify_checksum=*/true);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp(mapped.get(), table.get(), sizeof(g1::affine_element) * num_points), 0);
+    EXPECT_EQ(srs::PointTableFile<curve::BN254>::map(path, num_points + 1, source_fingerprint), nullptr);
+
+    // A table built from other transcripts must be rejected.
+    EXPECT_EQ(srs::PointTableFile<curve::BN254>::map(path, 1, source_fingerprint + 1), nullptr);
+
+    // The wrong curve must be rejected.
+    EXPECT_EQ(srs::PointTableFile<curve::Grumpkin>::map(path, 1, source_fingerprint), nullptr);
+
+    // The mapping outlives the file.
+    std::remove(path.c_str());
+    EXPECT_EQ(mapped[0], g1::affine_one);
+}
+
+TEST(point_table_file, file_crs_factory_uses_point_table_file)
+{
+    const size_t num_points = 1024;
+    const std::string path = "../srs_db/ignition";
+    std::remove(srs::PointTableFile<curve::BN254>::get_path(path).c_str());
+
+    // The first load builds the table from the transcript and writes it out, the second one maps it.
+    auto built = srs::factories::load_pippenger_point_table<curve::BN254>(path, num_points);
+    const uint64_t source_fingerprint = srs::PointTableFile<curve::BN254>::get_source_fingerprint(path);
+    auto mapped = srs::PointTableFile<curve::BN254>::map(
+        srs::PointTableFile<curve::BN254>::get_path(path), num_points, source_fingerprint, /*verify_checksum=*/true);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp(mapped.get(), built.get(), sizeof(g1::affine_element) * 2 * num_points), 0);
+}
+
+TEST(point_table_file, source_fingerprint_tracks_transcripts)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "point_table_file_fingerprint_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "monomial");
+    const auto write_transcript = [&](size_t num, std::string const& contents) {
+        std::ofstream(srs::IO<curve::BN254>::get_transcript_path(dir.string(), num), std::ios::binary) << contents;
+    };
+    const auto fingerprint = [&]() { return srs::PointTableFile<curve::BN254>::get_source_fingerprint(dir.string()); };
+
+    write_transcript(0, "transcript");
+    const uint64_t original = fingerprint();
+    EXPECT_EQ(fingerprint(), original);
+
+    // Replacing a transcript
+    write_transcript(0, "other transcript");
+    const uint64_t replaced = fingerprint();
+    EXPECT_NE(replaced, original);
+
+    // Adding one
+    write_transcript(1, "transcript");
+    EXPECT_NE(fingerprint(), replaced);
+
+    std::filesystem::remove_all(dir);
+}
@@ -959,6 +959,100 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeSparse)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    // Mostly zeros, with ones, short scalars of various sizes and a few dense scalars
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (engine.get_random_uint32() % 8) {
+        case 0:
+            scalars[i] = Fr::one();
+            break;
+        case 1:
+            scalars[i] = Fr(engine.get_random_uint32() & 0xffU);
+            break;
+        case 2:
+            scalars[i] = Fr(engine.get_random_uint32());
+            break;
+        case 3:
+            scalars[i] = Fr::random_element();
+            break;
+        default:
+            scalars[i] = Fr::zero();
+            break;
+        }
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    Element result =
+        scalar_multiplication::pippenger_unsafe_sparse<Curve>(scalars.data(), points.get(), num_points, state);
+    result = result.normalize();
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 4096;
+    // MSMs of different sizes, including an empty one and one with only a few points
+    const std::vector<size_t> msm_sizes = { 1000, num_points, 3, 0, 2048, 517, num_points };
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    std::vector<std::vector<Fr>> scalar_sets;
+    std::vector<Element> expected;
+    for (const size_t msm_size : msm_sizes) {
+        std::vector<Fr> scalars(msm_size);
+        Element accumulator;
+        accumulator.self_set_infinity();
+        for (size_t i = 0; i < msm_size; ++i) {
+            // Sprinkle in some zero scalars, which produce no wnaf entries at all
+            scalars[i] = (i % 7 == 3) ? Fr::zero() : Fr::random_element();
+            accumulator += points[i] * scalars[i];
+        }
+        scalar_sets.emplace_back(std::move(scalars));
+        expected.emplace_back(accumulator.normalize());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    std::vector<std::span<const Fr>> scalar_spans(scalar_sets.begin(), scalar_sets.end());
+    auto results = scalar_multiplication::pippenger_unsafe_batch<Curve>(scalar_spans, points.get());
+
+    ASSERT_EQ(results.size(), msm_sizes.size());
+    for (size_t i = 0; i < msm_sizes.size(); ++i) {
+        EXPECT_EQ(results[i].normalize() == expected[i], true);
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
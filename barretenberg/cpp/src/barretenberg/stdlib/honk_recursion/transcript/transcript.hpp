@@ -2,6 +2,7 @@
 
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/stdlib/hash/poseidon2/poseidon2.hpp"
+#include "barretenberg/stdlib/hash/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/stdlib/primitives/field/field_conversion.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -33,6 +34,97 @@ template <typename Builder> struct StdlibTranscriptParams {
             return hash_field_ct;
         }
     }
+
+    /**
+     * @brief The sponge of the SPLIT_SPONGE challenge mode
+     * @details As with `hash`, the permutations are only constrained with the Mega builder, which has Poseidon2 gates;
+     * with other builders the sponge runs natively and its outputs are added as witnesses.
+     */
+    class Sponge {
+        using Params = crypto::Poseidon2Bn254ScalarFieldParams;
+        static constexpr bool IN_CIRCUIT = std::is_same_v<Builder, MegaCircuitBuilder>;
+        using CircuitSponge =
+            stdlib::FieldSponge<Params::t - 1, 1, Params::t, stdlib::Poseidon2Permutation<Params, Builder>, Builder>;
+        using NativeSponge = crypto::Poseidon2<Params>::Sponge;
+
+      public:
+        explicit Sponge(Builder& builder)
+            : builder(&builder)
+            , sponge(make_sponge(builder))
+        {}
+
+        void absorb(const Fr& input)
+        {
+            if constexpr (IN_CIRCUIT) {
+                sponge.absorb(input);
+            } else {
+                sponge.absorb(input.get_value());
+            }
+        }
+
+        Fr squeeze()
+        {
+            if constexpr (IN_CIRCUIT) {
+                return sponge.squeeze();
+            } else {
+                return Fr::from_witness(builder, sponge.squeeze());
+            }
+        }
+
+      private:
+        Builder* builder;
+        std::conditional_t<IN_CIRCUIT, CircuitSponge, NativeSponge> sponge;
+
+        static auto make_sponge(Builder& builder)
+        {
+            if constexpr (IN_CIRCUIT) {
+                return CircuitSponge(builder);
+            } else {
+                return NativeSponge();
+            }
+        }
+    };
+
+    static Sponge create_sponge(const Fr& first_element)
+    {
+        ASSERT(first_element.get_context() != nullptr);
+        return Sponge(*first_element.get_context());
+    }
+
+    static constexpr size_t CHALLENGE_LO_BITS = NativeTranscriptParams::CHALLENGE_LO_BITS;
+    static constexpr size_t CHALLENGE_HI_BITS = 254 - CHALLENGE_LO_BITS;
+
+    /**
+     * @brief Split a challenge into its low 128 bits and its remaining high bits, as NativeTranscriptParams does
+     * @details Besides range constraining the halves, checks that lo + hi * 2^128 < r, so that the split is unique and
+     * the prover cannot choose the challenges out of two splits of the same value.
+     */
+    static std::array<Fr, 2> split_challenge(const Fr& challenge)
+    {
+        Builder* builder = challenge.get_context();
+        const auto native_halves = NativeTranscriptParams::split_challenge(challenge.get_value());
+        Fr lo = Fr::from_witness(builder, native_halves[0]);
+        Fr hi = Fr::from_witness(builder, native_halves[1]);
+        lo.create_range_constraint(CHALLENGE_LO_BITS, "split_challenge: lo too large");
+        hi.create_range_constraint(CHALLENGE_HI_BITS, "split_challenge: hi too large");
+        const Fr shift(bb::fr(uint256_t(1) << CHALLENGE_LO_BITS));
+        challenge.assert_equal(lo + hi * shift, "split_challenge: halves do not add up");
+
+        // Check lo + hi * 2^128 <= r - 1 = r_lo + r_hi * 2^128 by a subtraction with borrow, in which both limbs of the
+        // difference must be non-negative
+        const uint256_t r_minus_one = bb::fr::modulus - 1;
+        const uint256_t r_lo = r_minus_one.slice(0, CHALLENGE_LO_BITS);
+        const uint256_t r_hi = r_minus_one.slice(CHALLENGE_LO_BITS, 256);
+        const bool needs_borrow = uint256_t(native_halves[0]) > r_lo;
+        Fr borrow = Fr(bool_t<Builder>(witness_t<Builder>(builder, needs_borrow)));
+        Fr difference_lo = Fr(bb::fr(r_lo)) - lo + borrow * shift;
+        Fr difference_hi = Fr(bb::fr(r_hi)) - hi - borrow;
+        difference_lo.create_range_constraint(CHALLENGE_LO_BITS, "split_challenge: challenge not reduced");
+        difference_hi.create_range_constraint(CHALLENGE_HI_BITS, "split_challenge: challenge not reduced");
+
+        return { lo, hi };
+    }
+
     template <typename T> static inline T convert_challenge(const Fr& challenge)
     {
         Builder* builder = challenge.get_context();
@@ -179,4 +179,83 @@ TEST(RecursiveHonkTranscript, ReturnValuesMatch)
     EXPECT_EQ(static_cast<FF>(native_alpha), stdlib_alpha.get_value());
     EXPECT_EQ(static_cast<FF>(native_beta), stdlib_beta.get_value());
 }
-} // namespace bb::stdlib::recursion::honk
\ No newline at end of file
+
+/**
+ * @brief Check that in the SPLIT_SPONGE mode the stdlib verifier transcript derives the same challenges as the native
+ * prover and verifier transcripts, with a valid circuit
+ */
+template <typename OuterBuilder> void test_split_sponge_challenges_match()
+{
+    using field_ct = field_t<OuterBuilder>;
+    using fq_ct = bigfield<OuterBuilder, bb::Bn254FqParams>;
+    using element_ct = element<OuterBuilder, fq_ct, field_ct, bb::g1>;
+    using Commitment = g1::affine_element;
+    using OuterStdlibTranscript = BaseTranscript<StdlibTranscriptParams<OuterBuilder>>;
+
+    auto scalar = FF::random_element();
+    auto commitment = Commitment::one() * FF::random_element();
+    std::array<FF, 10> evaluations;
+    for (auto& eval : evaluations) {
+        eval = FF::random_element();
+    }
+
+    NativeTranscript prover_transcript(TranscriptChallengeMode::SPLIT_SPONGE);
+    prover_transcript.send_to_verifier("scalar", scalar);
+    prover_transcript.send_to_verifier("commitment", commitment);
+    auto [alpha, beta, gamma] = prover_transcript.template get_challenges<FF>("alpha", "beta", "gamma");
+    prover_transcript.send_to_verifier("evaluations", evaluations);
+    auto delta = prover_transcript.template get_challenge<FF>("delta");
+    auto eta = prover_transcript.template get_challenge<FF>("eta");
+
+    // Every challenge is one half of a split hash output
+    for (const auto& challenge : { alpha, beta, gamma, delta, eta }) {
+        EXPECT_LT(uint256_t(challenge).get_msb(), 128);
+    }
+    EXPECT_NE(alpha, beta);
+    EXPECT_NE(delta, eta);
+
+    NativeTranscript native_transcript(prover_transcript.proof_data, TranscriptChallengeMode::SPLIT_SPONGE);
+    native_transcript.template receive_from_prover<FF>("scalar");
+    native_transcript.template receive_from_prover<Commitment>("commitment");
+    auto native_challenges = native_transcript.template get_challenges<FF>("alpha", "beta", "gamma");
+    native_transcript.template receive_from_prover<std::array<FF, 10>>("evaluations");
+    auto native_delta = native_transcript.template get_challenge<FF>("delta");
+    auto native_eta = native_transcript.template get_challenge<FF>("eta");
+    EXPECT_EQ(native_challenges, (std::array<FF, 3>{ alpha, beta, gamma }));
+    EXPECT_EQ(native_delta, delta);
+    EXPECT_EQ(native_eta, eta);
+
+    // The mode is a property of each transcript: one in the default mode derives other challenges from the same proof
+    NativeTranscript default_transcript(prover_transcript.proof_data);
+    default_transcript.template receive_from_prover<FF>("scalar");
+    default_transcript.template receive_from_prover<Commitment>("commitment");
+    EXPECT_NE(default_transcript.template get_challenge<FF>("alpha"), alpha);
+
+    OuterBuilder builder;
+    StdlibProof<OuterBuilder> stdlib_proof = bb::convert_proof_to_witness(&builder, prover_transcript.proof_data);
+    OuterStdlibTranscript stdlib_transcript{ stdlib_proof, TranscriptChallengeMode::SPLIT_SPONGE };
+    stdlib_transcript.template receive_from_prover<field_ct>("scalar");
+    stdlib_transcript.template receive_from_prover<element_ct>("commitment");
+    auto stdlib_challenges = stdlib_transcript.template get_challenges<field_ct>("alpha", "beta", "gamma");
+    stdlib_transcript.template receive_from_prover<std::array<field_ct, 10>>("evaluations");
+    auto stdlib_delta = stdlib_transcript.template get_challenge<field_ct>("delta");
+    auto stdlib_eta = stdlib_transcript.template get_challenge<field_ct>("eta");
+    EXPECT_EQ(stdlib_challenges[0].get_value(), alpha);
+    EXPECT_EQ(stdlib_challenges[1].get_value(), beta);
+    EXPECT_EQ(stdlib_challenges[2].get_value(), gamma);
+    EXPECT_EQ(stdlib_delta.get_value(), delta);
+    EXPECT_EQ(stdlib_eta.get_value(), eta);
+    EXPECT_EQ(stdlib_transcript.get_manifest(), native_transcript.get_manifest());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
+TEST(RecursiveHonkTranscript, SplitSpongeChallengesMatchUltra)
+{
+    test_split_sponge_challenges_match<UltraCircuitBuilder>();
+}
+
+TEST(RecursiveHonkTranscript, SplitSpongeChallengesMatchMega)
+{
+    test_split_sponge_challenges_match<MegaCircuitBuilder>();
+}
+} // namespace bb::stdlib::recursion::honk
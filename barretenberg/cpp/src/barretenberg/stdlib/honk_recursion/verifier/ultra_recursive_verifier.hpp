@@ -19,8 +19,10 @@ template <typename Flavor> class UltraRecursiveVerifier_ {
     using PairingPoints = std::array<GroupElement, 2>;
     using Transcript = bb::BaseTranscript<bb::stdlib::recursion::honk::StdlibTranscriptParams<Builder>>;
 
-    explicit UltraRecursiveVerifier_(Builder* builder,
-                                     const std::shared_ptr<NativeVerificationKey>& native_verifier_key);
+    explicit UltraRecursiveVerifier_(
+        Builder* builder,
+        const std::shared_ptr<NativeVerificationKey>& native_verifier_key,
+        TranscriptChallengeMode challenge_mode = TranscriptChallengeMode::HASH_PER_CHALLENGE);
 
     // TODO(luke): Eventually this will return something like aggregation_state but I'm simplifying for now until we
     // determine the exact interface. Simply returns the two pairing points.
@@ -31,6 +33,8 @@ template <typename Flavor> class UltraRecursiveVerifier_ {
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     Builder* builder;
     std::shared_ptr<Transcript> transcript;
+    // The challenge mode the inner proof was generated with
+    TranscriptChallengeMode challenge_mode;
 };
 
 // Instance declarations for Ultra and Goblin-Ultra verifier circuits with both conventional Ultra and Goblin-Ultra
@@ -21,19 +21,13 @@ void CircuitBuilderBase<FF>::assert_equal(const uint32_t a_variable_idx,
     if (!values_equal && !failed()) {
         failure(msg);
     }
-    uint32_t a_real_idx = real_variable_index[a_variable_idx];
-    uint32_t b_real_idx = real_variable_index[b_variable_idx];
+    uint32_t a_real_idx = variable_classes[a_variable_idx];
+    uint32_t b_real_idx = variable_classes[b_variable_idx];
     // If a==b is already enforced, exit method
     if (a_real_idx == b_real_idx)
         return;
-    // Otherwise update the real_idx of b-chain members to that of a
-
-    auto b_start_idx = get_first_variable_in_class(b_variable_idx);
-    update_real_variable_indices(b_start_idx, a_real_idx);
-    // Now merge equivalence classes of a and b by tying last (= real) element of b-chain to first element of a-chain
-    auto a_start_idx = get_first_variable_in_class(a_variable_idx);
-    next_var_index[b_real_idx] = a_start_idx;
-    prev_var_index[a_start_idx] = b_real_idx;
+    // Otherwise merge the equivalence classes of a and b; the b-chain members take the real_idx of a
+    variable_classes.merge(a_variable_idx, b_variable_idx);
     bool no_tag_clash = (real_variable_tags[a_real_idx] == DUMMY_TAG || real_variable_tags[b_real_idx] == DUMMY_TAG ||
                          real_variable_tags[a_real_idx] == real_variable_tags[b_real_idx]);
     if (!no_tag_clash && !failed()) {
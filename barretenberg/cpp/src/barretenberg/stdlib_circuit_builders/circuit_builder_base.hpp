@@ -4,6 +4,7 @@
 #include "barretenberg/plonk_honk_shared/arithmetization/arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/gate_data.hpp"
 #include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/stdlib_circuit_builders/variable_union_find.hpp"
 #include <utility>
 
 #include <unordered_map>
@@ -22,18 +23,16 @@ template <typename FF_> class CircuitBuilderBase {
     std::vector<FF> variables;
     std::unordered_map<uint32_t, std::string> variable_names;
 
-    // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-    std::vector<uint32_t> next_var_index;
-    // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-    std::vector<uint32_t> prev_var_index;
-    // indices of corresponding real variables
-    std::vector<uint32_t> real_variable_index;
+    // the equivalence classes of variables under assert_equal; variable_classes[i] is the index of the real variable
+    // of variable i (see VariableUnionFind)
+    VariableUnionFind variable_classes;
     std::vector<uint32_t> real_variable_tags;
     uint32_t current_tag = DUMMY_TAG;
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
     // DOCTODO(#231): replace with the relevant wiki link.
-    std::map<uint32_t, uint32_t> tau;
+    // Tags are small consecutive integers, so tau[tag] is stored densely
+    std::vector<uint32_t> tau;
 
     // Public input indices which contain recursive proof information
     std::vector<uint32_t> recursive_proof_public_input_indices;
@@ -48,16 +47,13 @@ template <typename FF_> class CircuitBuilderBase {
 
     bool _failed = false;
     std::string _err;
-    static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
-    static constexpr uint32_t FIRST_VARIABLE_IN_CLASS = UINT32_MAX - 2;
+    static constexpr uint32_t REAL_VARIABLE = VariableUnionFind::REAL_VARIABLE;
 
     CircuitBuilderBase(size_t size_hint = 0)
     {
         variables.reserve(size_hint * 3);
         variable_names.reserve(size_hint * 3);
-        next_var_index.reserve(size_hint * 3);
-        prev_var_index.reserve(size_hint * 3);
-        real_variable_index.reserve(size_hint * 3);
+        variable_classes.reserve(size_hint * 3);
         real_variable_tags.reserve(size_hint * 3);
     }
 
@@ -91,24 +87,7 @@ template <typename FF_> class CircuitBuilderBase {
      * */
     uint32_t get_first_variable_in_class(uint32_t index) const
     {
-        while (prev_var_index[index] != FIRST_VARIABLE_IN_CLASS) {
-            index = prev_var_index[index];
-        }
-        return index;
-    }
-    /**
-     * Update all variables from index in equivalence class to have real variable new_real_index.
-     *
-     * @param index The index of a variable in the class we're updating.
-     * @param new_real_index The index of the real variable to update to.
-     * */
-    void update_real_variable_indices(uint32_t index, uint32_t new_real_index)
-    {
-        auto cur_index = index;
-        do {
-            real_variable_index[cur_index] = new_real_index;
-            cur_index = next_var_index[cur_index];
-        } while (cur_index != REAL_VARIABLE);
+        return variable_classes.get_first_variable_in_class(index);
     }
 
     /**
@@ -121,7 +100,7 @@ template <typename FF_> class CircuitBuilderBase {
     inline FF get_variable(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[variable_classes[index]];
     }
 
     /**
@@ -135,14 +114,14 @@ template <typename FF_> class CircuitBuilderBase {
     inline const FF& get_variable_reference(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[variable_classes[index]];
     }
 
     uint32_t get_public_input_index(const uint32_t witness_index) const
     {
         uint32_t result = static_cast<uint32_t>(-1);
         for (size_t i = 0; i < public_inputs.size(); ++i) {
-            if (real_variable_index[public_inputs[i]] == real_variable_index[witness_index]) {
+            if (variable_classes[public_inputs[i]] == variable_classes[witness_index]) {
                 result = static_cast<uint32_t>(i);
                 break;
             }
@@ -174,10 +153,7 @@ template <typename FF_> class CircuitBuilderBase {
 
         // By default, we assume each new variable belongs in its own copy-cycle. These defaults can be modified later
         // by `assert_equal`.
-        const uint32_t index = static_cast<uint32_t>(variables.size()) - 1U;
-        real_variable_index.emplace_back(index);
-        next_var_index.emplace_back(REAL_VARIABLE);
-        prev_var_index.emplace_back(FIRST_VARIABLE_IN_CLASS);
+        const uint32_t index = variable_classes.add_variable();
         real_variable_tags.emplace_back(DUMMY_TAG);
         return index;
     }
@@ -212,9 +188,9 @@ template <typename FF_> class CircuitBuilderBase {
     {
         uint32_t first_idx = get_first_variable_in_class(index);
 
-        uint32_t cur_idx = next_var_index[first_idx];
+        uint32_t cur_idx = variable_classes.get_next_variable_in_class(first_idx);
         while (cur_idx != REAL_VARIABLE && !variable_names.contains(cur_idx)) {
-            cur_idx = next_var_index[cur_idx];
+            cur_idx = variable_classes.get_next_variable_in_class(cur_idx);
         }
 
         if (variable_names.contains(first_idx)) {
@@ -376,7 +352,7 @@ template <typename FF_> class CircuitBuilderBase {
         contains_recursive_proof = true;
         for (size_t i = 0; i < proof_output_witness_indices.size(); ++i) {
             recursive_proof_public_input_indices.push_back(
-                get_public_input_index(real_variable_index[proof_output_witness_indices[i]]));
+                get_public_input_index(variable_classes[proof_output_witness_indices[i]]));
         }
     }
 
@@ -549,7 +525,8 @@ template <typename FF_> class CircuitBuilderBase {
  * In our example, we have `variables[6].assert_equal(variables[7])`. The `assert_equal` function modifies the above
  * vectors' entries for variables 6 & 7 to imply a copy-cycle between them. Arbitrarily, variables[7] is deemed the
  * "first" in the cycle and variables[6] is considered the last (and hence the "real" variable which represents the
- * cycle).
+ * cycle). (The builder no longer stores these vectors as such: VariableUnionFind keeps the same classes, order and
+ * real variables in a union-find forest, and `variable_classes[i]` reads as `real_var_index[i]` above.)
  *
  * By the time we get to computing wire copy-cycles, we need to allow for public_inputs, which in the plonk protocol
  * are positioned to be the first witness values. `variables` doesn't include these public inputs (they're stored
@@ -308,6 +308,7 @@ class MegaFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
 
         void set_shifted()
         {
@@ -327,8 +328,10 @@ class MegaFlavor {
         using Base = ProvingKey_<FF, CommitmentKey>;
         using Base::Base;
 
-        ProvingKey(const size_t circuit_size, const size_t num_public_inputs)
-            : Base(circuit_size, num_public_inputs)
+        ProvingKey(const size_t circuit_size,
+                   const size_t num_public_inputs,
+                   std::shared_ptr<CommitmentKey> commitment_key = nullptr)
+            : Base(circuit_size, num_public_inputs, std::move(commitment_key))
             , polynomials(circuit_size){};
 
         std::vector<uint32_t> memory_read_records;
@@ -802,8 +805,13 @@ class MegaFlavor {
 
         Transcript_() = default;
 
-        Transcript_(const HonkProof& proof)
-            : NativeTranscript(proof)
+        explicit Transcript_(TranscriptChallengeMode challenge_mode)
+            : NativeTranscript(challenge_mode)
+        {}
+
+        Transcript_(const HonkProof& proof,
+                    TranscriptChallengeMode challenge_mode = TranscriptChallengeMode::HASH_PER_CHALLENGE)
+            : NativeTranscript(proof, challenge_mode)
         {}
 
         static std::shared_ptr<Transcript_> prover_init_empty()
@@ -84,3 +84,29 @@ TEST_F(PermutationHelperTests, ComputeStandardAuxPolynomials)
     // TODO(#425) Flesh out these tests
     compute_first_and_last_lagrange_polynomials<FF>(1024);
 }
+
+TEST(CopyCycles, GroupsNodesByCycleInOrder)
+{
+    // Nodes of cycles 2, 0, 2, 3, 0 (cycle 1 is empty)
+    std::vector<uint32_t> node_cycles{ 2, 0, 2, 3, 0 };
+    std::vector<cycle_node> nodes{ { 0, 10 }, { 1, 11 }, { 2, 12 }, { 3, 13 }, { 0, 14 } };
+    CopyCycles cycles(4, node_cycles, nodes);
+
+    EXPECT_EQ(cycles.size(), 4);
+    EXPECT_EQ(cycles.offsets, (std::vector<size_t>{ 0, 2, 2, 4, 5 }));
+    std::vector<uint32_t> rows;
+    for (size_t cycle = 0; cycle < cycles.size(); ++cycle) {
+        for (const auto& node : cycles[cycle]) {
+            rows.push_back(node.gate_index);
+        }
+    }
+    EXPECT_EQ(rows, (std::vector<uint32_t>{ 11, 14, 10, 12, 13 }));
+
+    // The thread ranges cover every cycle exactly once
+    const size_t num_threads = 3;
+    EXPECT_EQ(cycles.get_range_start(0, num_threads), 0);
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        EXPECT_LE(cycles.get_range_start(thread_idx, num_threads), cycles.get_range_start(thread_idx + 1, num_threads));
+    }
+    EXPECT_EQ(cycles.get_range_start(num_threads, num_threads), cycles.size());
+}
@@ -533,11 +533,11 @@ template <typename FF> msgpack::sbuffer StandardCircuitBuilder_<FF>::export_circ
     cir.modulus = buf.str();
 
     for (uint32_t i = 0; i < this->get_num_public_inputs(); i++) {
-        cir.public_inps.push_back(this->real_variable_index[this->public_inputs[i]]);
+        cir.public_inps.push_back(this->variable_classes[this->public_inputs[i]]);
     }
 
     for (auto& tup : base::variable_names) {
-        cir.vars_of_interest.insert({ this->real_variable_index[tup.first], tup.second });
+        cir.vars_of_interest.insert({ this->variable_classes[tup.first], tup.second });
     }
 
     for (auto var : this->variables) {
@@ -551,15 +551,15 @@ template <typename FF> msgpack::sbuffer StandardCircuitBuilder_<FF>::export_circ
                                     blocks.arithmetic.q_3()[i],
                                     blocks.arithmetic.q_c()[i] };
         std::vector<uint32_t> tmp_w = {
-            this->real_variable_index[blocks.arithmetic.w_l()[i]],
-            this->real_variable_index[blocks.arithmetic.w_r()[i]],
-            this->real_variable_index[blocks.arithmetic.w_o()[i]],
+            this->variable_classes[blocks.arithmetic.w_l()[i]],
+            this->variable_classes[blocks.arithmetic.w_r()[i]],
+            this->variable_classes[blocks.arithmetic.w_o()[i]],
         };
         cir.selectors.push_back(tmp_sel);
         cir.wires.push_back(tmp_w);
     }
 
-    cir.real_variable_index = this->real_variable_index;
+    cir.real_variable_index = this->variable_classes.get_real_variable_indices();
 
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, cir);
@@ -49,6 +49,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         // Gates added after first call to finalize will not be processed since finalization is only performed once
         info("WARNING: Redudant call to finalize_circuit(). Is this intentional?");
     }
+    this->variable_classes.compress_paths();
 }
 
 /**
@@ -837,7 +838,7 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
         range_lists.insert({ target_range, create_range_list(target_range) });
     }
 
-    const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
+    const auto existing_tag = this->real_variable_tags[this->variable_classes[variable_index]];
     auto& list = range_lists[target_range];
 
     // If the variable's tag matches the target range list's tag, do nothing.
@@ -887,7 +888,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // applied on a variable after it was range constrained, this makes sure the indices in list point to the updated
     // index in the range list so the set equivalence does not fail
     for (uint32_t& x : list.variable_indices) {
-        x = this->real_variable_index[x];
+        x = this->variable_classes[x];
     }
     // remove duplicate witness indices to prevent the sorted list set size being wrong!
     std::sort(list.variable_indices.begin(), list.variable_indices.end());
@@ -1717,8 +1718,8 @@ void UltraCircuitBuilder_<Arithmetization>::process_non_native_field_multiplicat
     for (size_t i = 0; i < cached_partial_non_native_field_multiplications.size(); ++i) {
         auto& c = cached_partial_non_native_field_multiplications[i];
         for (size_t j = 0; j < 5; ++j) {
-            c.a[j] = this->real_variable_index[c.a[j]];
-            c.b[j] = this->real_variable_index[c.b[j]];
+            c.a[j] = this->variable_classes[c.a[j]];
+            c.b[j] = this->variable_classes[c.b[j]];
         }
     }
     cached_partial_non_native_field_multiplication::deduplicate(cached_partial_non_native_field_multiplications);
@@ -2697,7 +2698,7 @@ template <typename Arithmetization> uint256_t UltraCircuitBuilder_<Arithmetizati
 
     size_t num_bytes_in_selectors = sizeof(FF) * Arithmetization::NUM_SELECTORS * sum_of_block_sizes;
     size_t num_bytes_in_wires_and_copy_constraints =
-        sizeof(uint32_t) * (Arithmetization::NUM_WIRES * sum_of_block_sizes + this->real_variable_index.size());
+        sizeof(uint32_t) * (Arithmetization::NUM_WIRES * sum_of_block_sizes + this->variable_classes.size());
     size_t num_bytes_to_hash = num_bytes_in_selectors + num_bytes_in_wires_and_copy_constraints;
 
     std::vector<uint8_t> to_hash(num_bytes_to_hash);
@@ -2711,7 +2712,8 @@ template <typename Arithmetization> uint256_t UltraCircuitBuilder_<Arithmetizati
         std::for_each(block.selectors.begin(), block.selectors.end(), convert_and_insert);
         std::for_each(block.wires.begin(), block.wires.end(), convert_and_insert);
     }
-    convert_and_insert(this->real_variable_index);
+    auto real_variable_indices = this->variable_classes.get_real_variable_indices();
+    convert_and_insert(real_variable_indices);
 
     return from_buffer<uint256_t>(crypto::sha256(to_hash));
 }
@@ -315,7 +315,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): reserve space in blocks here somehow?
         this->zero_idx = put_constant_variable(FF::zero());
-        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+        this->tau.assign(1, DUMMY_TAG); // tau[DUMMY_TAG] = DUMMY_TAG. TODO(luke): explain this
     };
     /**
      * @brief Constructor from data generated from ACIR
@@ -353,7 +353,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         // Add the const zero variable after the acir witness has been
         // incorporated into variables.
         this->zero_idx = put_constant_variable(FF::zero());
-        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+        this->tau.assign(1, DUMMY_TAG); // tau[DUMMY_TAG] = DUMMY_TAG. TODO(luke): explain this
 
         this->is_recursive_circuit = recursive;
     };
@@ -728,16 +728,19 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         ASSERT(tag <= this->current_tag);
         // If we've already assigned this tag to this variable, return (can happen due to copy constraints)
-        if (this->real_variable_tags[this->real_variable_index[variable_index]] == tag) {
+        if (this->real_variable_tags[this->variable_classes[variable_index]] == tag) {
             return;
         }
-        ASSERT(this->real_variable_tags[this->real_variable_index[variable_index]] == DUMMY_TAG);
-        this->real_variable_tags[this->real_variable_index[variable_index]] = tag;
+        ASSERT(this->real_variable_tags[this->variable_classes[variable_index]] == DUMMY_TAG);
+        this->real_variable_tags[this->variable_classes[variable_index]] = tag;
     }
 
     uint32_t create_tag(const uint32_t tag_index, const uint32_t tau_index)
     {
-        this->tau.insert({ tag_index, tau_index });
+        if (this->tau.size() <= tag_index) {
+            this->tau.resize(tag_index + 1, DUMMY_TAG);
+        }
+        this->tau[tag_index] = tau_index;
         this->current_tag++; // Why exactly?
         return this->current_tag;
     }
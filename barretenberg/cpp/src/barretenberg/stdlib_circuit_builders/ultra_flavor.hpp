@@ -315,6 +315,7 @@ class UltraFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
 
         // Set all shifted polynomials based on their to-be-shifted counterpart
         void set_shifted()
@@ -334,8 +335,10 @@ class UltraFlavor {
         using Base = ProvingKey_<FF, CommitmentKey>;
         using Base::Base;
 
-        ProvingKey(const size_t circuit_size, const size_t num_public_inputs)
-            : Base(circuit_size, num_public_inputs)
+        ProvingKey(const size_t circuit_size,
+                   const size_t num_public_inputs,
+                   std::shared_ptr<CommitmentKey> commitment_key = nullptr)
+            : Base(circuit_size, num_public_inputs, std::move(commitment_key))
             , polynomials(circuit_size){};
 
         std::vector<uint32_t> memory_read_records;
@@ -732,9 +735,14 @@ class UltraFlavor {
 
         Transcript() = default;
 
+        explicit Transcript(TranscriptChallengeMode challenge_mode)
+            : NativeTranscript(challenge_mode)
+        {}
+
         // Used by verifier to initialize the transcript
-        Transcript(const std::vector<FF>& proof)
-            : NativeTranscript(proof)
+        Transcript(const std::vector<FF>& proof,
+                   TranscriptChallengeMode challenge_mode = TranscriptChallengeMode::HASH_PER_CHALLENGE)
+            : NativeTranscript(proof, challenge_mode)
         {}
 
         static std::shared_ptr<Transcript> prover_init_empty()
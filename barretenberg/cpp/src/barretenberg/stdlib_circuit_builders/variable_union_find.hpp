@@ -0,0 +1,160 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief The equivalence classes of circuit variables under copy constraints, as a union-find forest
+ *
+ * @details Indexing it like the `real_variable_index` vector it replaces gives the real variable of a variable's class,
+ * i.e. the variable whose value all variables of the class take. Each class also keeps its members in a list, in the
+ * order the old `next_var_index` chains did: merging the class of b into the class of a puts the members of b's class
+ * in front of those of a's class, and the last member of a class is its real variable.
+ *
+ * Classes are merged by rank and paths are compressed whenever classes are merged, so a find takes a logarithmic
+ * number of steps at worst and close to constant time in practice, where walking the old linked lists took time
+ * linear in the size of the class. Lookups never modify the forest, so concurrent reads are safe.
+ */
+class VariableUnionFind {
+  public:
+    // Marks the last (i.e. the real) variable of a class in get_next_variable_in_class
+    static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
+
+    void reserve(size_t num_variables)
+    {
+        parent.reserve(num_variables);
+        rank.reserve(num_variables);
+        first_index.reserve(num_variables);
+        real_index.reserve(num_variables);
+        next_index.reserve(num_variables);
+    }
+
+    /**
+     * @brief Add variables up to `num_variables`, each in a class of its own
+     */
+    void resize(size_t num_variables)
+    {
+        for (auto index = static_cast<uint32_t>(size()); index < num_variables; ++index) {
+            add_variable();
+        }
+    }
+
+    /**
+     * @brief Add a variable in a class of its own
+     *
+     * @return The index of the new variable
+     */
+    uint32_t add_variable()
+    {
+        const auto index = static_cast<uint32_t>(size());
+        parent.emplace_back(index);
+        rank.emplace_back(0);
+        first_index.emplace_back(index);
+        real_index.emplace_back(index);
+        next_index.emplace_back(REAL_VARIABLE);
+        return index;
+    }
+
+    size_t size() const { return parent.size(); }
+
+    /**
+     * @brief The index of the real variable in the class of the variable at `index`
+     */
+    uint32_t operator[](size_t index) const { return real_index[find(static_cast<uint32_t>(index))]; }
+
+    uint32_t get_first_variable_in_class(uint32_t index) const { return first_index[find(index)]; }
+
+    /**
+     * @brief The member of the class following `index`, or REAL_VARIABLE if `index` is the real variable
+     */
+    uint32_t get_next_variable_in_class(uint32_t index) const { return next_index[index]; }
+
+    /**
+     * @brief Join the class of b to the class of a, keeping the real variable of a's class
+     *
+     * @return false if a and b were already in the same class
+     */
+    bool merge(uint32_t a, uint32_t b)
+    {
+        uint32_t a_root = find_and_compress(a);
+        uint32_t b_root = find_and_compress(b);
+        if (a_root == b_root) {
+            return false;
+        }
+        // Link the last (real) member of b's class to the first member of a's class
+        next_index[real_index[b_root]] = first_index[a_root];
+        const uint32_t first = first_index[b_root];
+        const uint32_t real = real_index[a_root];
+
+        if (rank[a_root] < rank[b_root]) {
+            std::swap(a_root, b_root);
+        }
+        parent[b_root] = a_root;
+        if (rank[a_root] == rank[b_root]) {
+            rank[a_root]++;
+        }
+        first_index[a_root] = first;
+        real_index[a_root] = real;
+        return true;
+    }
+
+    /**
+     * @brief The real variable of every variable, i.e. the contents of the old real_variable_index vector
+     */
+    std::vector<uint32_t> get_real_variable_indices() const
+    {
+        std::vector<uint32_t> result(size());
+        for (size_t i = 0; i < size(); ++i) {
+            result[i] = (*this)[i];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Point every variable directly at the root of its class
+     * @details Lookups do not compress paths, so this is done once the circuit is finalized: from then on every
+     * lookup made while building the execution trace and the copy cycles takes a single step. Later merges keep
+     * working as usual.
+     */
+    void compress_paths()
+    {
+        for (uint32_t index = 0; index < size(); ++index) {
+            parent[index] = find(index);
+        }
+    }
+
+    bool operator==(const VariableUnionFind& other) const = default;
+
+  private:
+    // parent[i] == i iff i is the root of its tree
+    std::vector<uint32_t> parent;
+    // Upper bound on the height of the tree of each root
+    std::vector<uint8_t> rank;
+    // The first and the real (= last) member of the class of each root; unused for other variables
+    std::vector<uint32_t> first_index;
+    std::vector<uint32_t> real_index;
+    // The member following each variable in its class
+    std::vector<uint32_t> next_index;
+
+    uint32_t find(uint32_t index) const
+    {
+        while (parent[index] != index) {
+            index = parent[index];
+        }
+        return index;
+    }
+
+    uint32_t find_and_compress(uint32_t index)
+    {
+        const uint32_t root = find(index);
+        while (parent[index] != root) {
+            index = std::exchange(parent[index], root);
+        }
+        return root;
+    }
+};
+
+} // namespace bb
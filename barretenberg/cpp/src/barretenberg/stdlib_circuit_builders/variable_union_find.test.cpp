@@ -0,0 +1,94 @@
+#include "barretenberg/stdlib_circuit_builders/variable_union_find.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief The linked-list bookkeeping CircuitBuilderBase used before VariableUnionFind, as a reference
+ */
+struct LinkedListClasses {
+    static constexpr uint32_t REAL_VARIABLE = VariableUnionFind::REAL_VARIABLE;
+    static constexpr uint32_t FIRST_VARIABLE_IN_CLASS = UINT32_MAX - 2;
+
+    std::vector<uint32_t> next_var_index;
+    std::vector<uint32_t> prev_var_index;
+    std::vector<uint32_t> real_variable_index;
+
+    void add_variable()
+    {
+        real_variable_index.emplace_back(static_cast<uint32_t>(real_variable_index.size()));
+        next_var_index.emplace_back(REAL_VARIABLE);
+        prev_var_index.emplace_back(FIRST_VARIABLE_IN_CLASS);
+    }
+
+    uint32_t get_first_variable_in_class(uint32_t index) const
+    {
+        while (prev_var_index[index] != FIRST_VARIABLE_IN_CLASS) {
+            index = prev_var_index[index];
+        }
+        return index;
+    }
+
+    void merge(uint32_t a, uint32_t b)
+    {
+        const uint32_t a_real_idx = real_variable_index[a];
+        const uint32_t b_real_idx = real_variable_index[b];
+        if (a_real_idx == b_real_idx) {
+            return;
+        }
+        uint32_t cur_index = get_first_variable_in_class(b);
+        do {
+            real_variable_index[cur_index] = a_real_idx;
+            cur_index = next_var_index[cur_index];
+        } while (cur_index != REAL_VARIABLE);
+        const uint32_t a_start_idx = get_first_variable_in_class(a);
+        next_var_index[b_real_idx] = a_start_idx;
+        prev_var_index[a_start_idx] = b_real_idx;
+    }
+};
+} // namespace
+
+/**
+ * @brief Random merges give the same real variables, first variables and class order as the linked lists
+ */
+TEST(VariableUnionFind, MatchesLinkedLists)
+{
+    constexpr size_t NUM_VARIABLES = 1 << 10;
+    constexpr size_t NUM_MERGES = 1 << 11;
+
+    VariableUnionFind classes;
+    LinkedListClasses expected;
+    classes.resize(NUM_VARIABLES / 2);
+    for (size_t i = 0; i < NUM_VARIABLES / 2; ++i) {
+        expected.add_variable();
+    }
+
+    for (size_t i = 0; i < NUM_MERGES; ++i) {
+        if (classes.size() < NUM_VARIABLES && (i % 4) == 0) {
+            EXPECT_EQ(classes.add_variable(), expected.real_variable_index.size());
+            expected.add_variable();
+        }
+        const auto a = static_cast<uint32_t>(engine.get_random_uint32() % classes.size());
+        const auto b = static_cast<uint32_t>(engine.get_random_uint32() % classes.size());
+        const bool merged = classes.merge(a, b);
+        EXPECT_EQ(merged, expected.real_variable_index[a] != expected.real_variable_index[b]);
+        expected.merge(a, b);
+        // Flattening the forest part way through does not change the classes
+        if (i == NUM_MERGES / 2) {
+            classes.compress_paths();
+        }
+    }
+
+    EXPECT_EQ(classes.get_real_variable_indices(), expected.real_variable_index);
+    classes.compress_paths();
+    for (uint32_t i = 0; i < classes.size(); ++i) {
+        EXPECT_EQ(classes[i], expected.real_variable_index[i]);
+        EXPECT_EQ(classes.get_first_variable_in_class(i), expected.get_first_variable_in_class(i));
+        EXPECT_EQ(classes.get_next_variable_in_class(i), expected.next_var_index[i]);
+    }
+}
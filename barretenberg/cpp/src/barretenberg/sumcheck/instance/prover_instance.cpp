@@ -64,6 +64,9 @@ void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     for (size_t i = 0; i < databus_id.size(); ++i) {
         databus_id[i] = i;
     }
+
+    // The databus columns do not live in the gate blocks, so mark their rows as active separately
+    proving_key.active_row_ranges.emplace_back(0, std::max(calldata.size(), return_data.size()));
 }
 
 template class ProverInstance_<UltraFlavor>;
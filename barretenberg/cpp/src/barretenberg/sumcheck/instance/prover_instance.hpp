@@ -41,7 +41,9 @@ template <class Flavor> class ProverInstance_ {
     std::vector<FF> gate_challenges;
     FF target_sum;
 
-    ProverInstance_(Circuit& circuit, bool is_structured = false)
+    ProverInstance_(Circuit& circuit,
+                    bool is_structured = false,
+                    std::shared_ptr<CommitmentKey> commitment_key = nullptr)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
@@ -65,7 +67,7 @@ template <class Flavor> class ProverInstance_ {
             dyadic_circuit_size = compute_dyadic_size(circuit);
         }
 
-        proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size());
+        proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), std::move(commitment_key));
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         Trace::populate(circuit, proving_key, is_structured);
@@ -79,6 +81,14 @@ template <class Flavor> class ProverInstance_ {
         proving_key.polynomials.lagrange_first[0] = 1;
         proving_key.polynomials.lagrange_last[dyadic_circuit_size - 1] = 1;
 
+        // Besides the gates, the relations are non-trivial on the rows of the lagrange polynomials and on the lookup
+        // tables and sorted lists at the end of the trace. (The sizes are read before the sorted list construction, which
+        // appends the table entries to the lookups of the circuit.)
+        const size_t lookup_data_size = circuit.get_tables_size() + circuit.get_lookups_size();
+        proving_key.active_row_ranges.emplace_back(0, 1);
+        proving_key.active_row_ranges.emplace_back(dyadic_circuit_size - std::max<size_t>(lookup_data_size, 1),
+                                                   dyadic_circuit_size);
+
         construct_lookup_table_polynomials<Flavor>(proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
 
         proving_key.sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
@@ -162,6 +162,11 @@ template <typename Flavor> class SumcheckProver {
      */
     SumcheckOutput<Flavor> prove(std::shared_ptr<Instance> instance)
     {
+        // The rows outside of the trace blocks can only be skipped if the relations hold on them, which is not the case
+        // for a relaxed instance produced by folding
+        if (!instance->is_accumulator) {
+            round.set_active_row_ranges(instance->proving_key.active_row_ranges);
+        }
         return prove(instance->proving_key.polynomials,
                      instance->relation_parameters,
                      instance->alphas,
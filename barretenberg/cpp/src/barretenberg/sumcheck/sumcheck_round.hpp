@@ -64,11 +64,63 @@ template <typename Flavor> class SumcheckProverRound {
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
+        , initial_round_size(initial_round_size)
     {
         // Initialize univariate accumulators to 0
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the computation of the round univariates to the edges meeting the given ranges of rows.
+     *
+     * @details On a row outside of the active ranges, every selector, wire, table and lagrange polynomial vanishes, as
+     * do their shifts, the sigma and id polynomials agree, and the relations reduce to constraints that are linear in
+     * the grand product polynomials with constant coefficients, e.g. \f$ z_{perm} - z_{perm, shift} \f$. Such a
+     * constraint holds on every row of an inactive block of the hypercube, hence on any multilinear combination of
+     * those rows, so an edge all of whose rows are inactive contributes the zero univariate and can be skipped in every
+     * round. The ranges are given in rows of the full hypercube and are mapped to the current round on the fly.
+     *
+     * @note This requires the relations to be satisfied on the inactive rows, so it must not be used on a relaxed
+     * (folded) instance.
+     *
+     * @param row_ranges Ranges [start, end) of rows outside of which the relations are trivial. Empty for all rows.
+     */
+    void set_active_row_ranges(std::vector<std::pair<size_t, size_t>> row_ranges)
+    {
+        std::sort(row_ranges.begin(), row_ranges.end());
+        active_row_ranges = std::move(row_ranges);
+    }
+
+    /**
+     * @brief Compute the sorted, disjoint ranges [start, end) of edges of the current round that meet an active row.
+     * @details Both ends of every range are even, i.e. ranges consist of whole edges.
+     */
+    std::vector<std::pair<size_t, size_t>> get_active_edge_ranges() const
+    {
+        if (active_row_ranges.empty()) {
+            return { { 0, round_size } };
+        }
+        // A row of the current round is a combination of 2^{log_ratio} consecutive rows of the full hypercube
+        const size_t log_ratio = numeric::get_msb(initial_round_size) - numeric::get_msb(round_size);
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        for (const auto& [row_start, row_end] : active_row_ranges) {
+            if (row_start >= row_end) {
+                continue;
+            }
+            // The relations on the row preceding a range read the shifts of its first row, so that row is active too
+            const size_t first_row = (row_start > 0 ? row_start - 1 : 0) >> log_ratio;
+            const size_t last_row = (row_end - 1) >> log_ratio;
+            const size_t start = first_row & ~static_cast<size_t>(1);
+            const size_t end = std::min(round_size, (last_row + 2) & ~static_cast<size_t>(1));
+            if (!edge_ranges.empty() && start <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(edge_ranges.back().second, end);
+            } else {
+                edge_ranges.emplace_back(start, end);
+            }
+        }
+        return edge_ranges;
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -137,13 +189,18 @@ template <typename Flavor> class SumcheckProverRound {
     {
         BB_OP_COUNT_TIME();
 
+        // Only the edges meeting an active row contribute to the round univariate
+        const auto edge_ranges = get_active_edge_ranges();
+        size_t num_active_edges = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_edges += (end - start) / 2;
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads(2 * num_active_edges, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -157,21 +214,30 @@ template <typename Flavor> class SumcheckProverRound {
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+            // The thread's share of the active edges, counted across all the ranges
+            const size_t start = (num_active_edges * thread_idx) / num_threads;
+            const size_t end = (num_active_edges * (thread_idx + 1)) / num_threads;
+
+            size_t range_offset = 0; // number of active edges in the preceding ranges
+            for (const auto& [range_start, range_end] : edge_ranges) {
+                const size_t range_num_edges = (range_end - range_start) / 2;
+                const size_t first = std::max(start, range_offset);
+                const size_t last = std::min(end, range_offset + range_num_edges);
+                for (size_t active_edge_idx = first; active_edge_idx < last; ++active_edge_idx) {
+                    const size_t edge_idx = range_start + 2 * (active_edge_idx - range_offset);
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+
+                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+                }
+                range_offset += range_num_edges;
             }
         });
 
@@ -263,6 +329,15 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief The size of the hypercube in the first round, used to map #active_row_ranges to the current round.
+     */
+    size_t initial_round_size;
+    /**
+     * @brief Sorted ranges [start, end) of rows of the full hypercube outside of which the relations are trivial.
+     */
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -3,12 +3,14 @@
 // #define LOG_CHALLENGES
 // #define LOG_INTERACTIONS
 
+#include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/fields/field_conversion.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include <concepts>
+#include <optional>
 
 namespace bb {
 
@@ -58,10 +60,34 @@ class TranscriptManifest {
     bool operator==(const TranscriptManifest& other) const = default;
 };
 
+/**
+ * @brief How a transcript absorbs the prover messages and derives the challenges
+ */
+enum class TranscriptChallengeMode {
+    // Every challenge is a Poseidon2 hash of the previous challenge and, for the first challenge of a round, of all the
+    // messages of the round
+    HASH_PER_CHALLENGE,
+    // The messages are absorbed into a Poseidon2 duplex sponge as they are sent, and every element squeezed from it is
+    // split into a 128-bit and a 126-bit challenge
+    SPLIT_SPONGE,
+};
+
 struct NativeTranscriptParams {
     using Fr = bb::fr;
     using Proof = HonkProof;
+    using Sponge = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::Sponge;
     static Fr hash(const std::vector<Fr>& data);
+    static Sponge create_sponge([[maybe_unused]] const Fr& first_element) { return Sponge(); }
+    /**
+     * @brief Split a challenge into its low 128 bits and its remaining high bits
+     * @details The modulus is below 2^254, so the high half has only 126 bits.
+     */
+    static std::array<Fr, 2> split_challenge(const Fr& challenge)
+    {
+        const uint256_t value(challenge);
+        return { Fr(value.slice(0, CHALLENGE_LO_BITS)), Fr(value.slice(CHALLENGE_LO_BITS, 256)) };
+    }
+    static constexpr size_t CHALLENGE_LO_BITS = 128;
     template <typename T> static inline T convert_challenge(const Fr& challenge)
     {
         return bb::field_conversion::convert_challenge<T>(challenge);
@@ -91,13 +117,26 @@ template <typename TranscriptParams> class BaseTranscript {
 
     BaseTranscript() = default;
 
+    /**
+     * @brief Construct a new Base Transcript object for Prover with the given challenge mode
+     *
+     * @param challenge_mode
+     */
+    explicit BaseTranscript(TranscriptChallengeMode challenge_mode)
+        : challenge_mode(challenge_mode)
+    {}
+
     /**
      * @brief Construct a new Base Transcript object for Verifier using proof_data
+     * @details The challenge mode must be the one the proof was generated with.
      *
      * @param proof_data
+     * @param challenge_mode
      */
-    explicit BaseTranscript(const Proof& proof_data)
-        : proof_data(proof_data.begin(), proof_data.end())
+    explicit BaseTranscript(const Proof& proof_data,
+                            TranscriptChallengeMode challenge_mode = TranscriptChallengeMode::HASH_PER_CHALLENGE)
+        : challenge_mode(challenge_mode)
+        , proof_data(proof_data.begin(), proof_data.end())
     {}
 
     static constexpr size_t HASH_OUTPUT_SIZE = 32;
@@ -108,9 +147,14 @@ template <typename TranscriptParams> class BaseTranscript {
     size_t round_number = 0;    // current round for manifest
 
   private:
+    using Sponge = typename TranscriptParams::Sponge;
+
+    TranscriptChallengeMode challenge_mode = TranscriptChallengeMode::HASH_PER_CHALLENGE;
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
     Fr previous_challenge{};        // default-initialized to zeros
     std::vector<Fr> current_round_data;
+    // The sponge of the SPLIT_SPONGE mode, created when the first element is absorbed
+    std::optional<Sponge> sponge;
 
     // "Manifest" object that records a summary of the transcript interactions
     TranscriptManifest manifest;
@@ -162,6 +206,19 @@ template <typename TranscriptParams> class BaseTranscript {
         return new_challenge;
     };
 
+    /**
+     * @brief Squeeze the next element from the sponge of the SPLIT_SPONGE mode
+     * @details The messages were absorbed as they were sent, so unlike get_next_challenge_buffer this does not hash
+     * them again. The sponge's state carries over from round to round, so every squeezed element depends on all the
+     * messages and challenges that preceded it.
+     */
+    [[nodiscard]] Fr get_next_sponge_output()
+    {
+        // As above, the first challenge must follow some prover message
+        ASSERT(sponge.has_value());
+        return sponge->squeeze();
+    }
+
   protected:
     /**
      * @brief Adds challenge elements to the current_round_buffer and updates the manifest.
@@ -174,7 +231,16 @@ template <typename TranscriptParams> class BaseTranscript {
         // Add an entry to the current round of the manifest
         manifest.add_entry(round_number, label, element_frs.size());
 
-        current_round_data.insert(current_round_data.end(), element_frs.begin(), element_frs.end());
+        if (challenge_mode == TranscriptChallengeMode::SPLIT_SPONGE) {
+            for (const Fr& element : element_frs) {
+                if (!sponge.has_value()) {
+                    sponge.emplace(TranscriptParams::create_sponge(element));
+                }
+                sponge->absorb(element);
+            }
+        } else {
+            current_round_data.insert(current_round_data.end(), element_frs.begin(), element_frs.end());
+        }
 
         num_frs_written += element_frs.size();
     }
@@ -239,10 +305,10 @@ template <typename TranscriptParams> class BaseTranscript {
     /**
      * @brief After all the prover messages have been sent, finalize the round by hashing all the data and then create
      * the number of requested challenges.
-     * @details Challenges are generated by iteratively hashing over the previous challenge, using
-     * get_next_challenge_buffer().
-     * TODO(#741): Optimizations for this function include generalizing type of hash, splitting hashes into
-     * multiple challenges.
+     * @details In the HASH_PER_CHALLENGE mode, challenges are generated by iteratively hashing over the previous
+     * challenge, using get_next_challenge_buffer(). In the SPLIT_SPONGE mode, every element squeezed from the sponge
+     * gives two challenges (if the number of challenges is odd, the high half of the last element is discarded).
+     * TODO(#741): Optimizations for this function include generalizing type of hash.
      *
      * @param labels human-readable names for the challenges for the manifest
      * @return std::array<Fr, num_challenges> challenges for this round.
@@ -260,6 +326,18 @@ template <typename TranscriptParams> class BaseTranscript {
         // Create challenges from Frs.
         std::array<ChallengeType, num_challenges> challenges{};
 
+        if (challenge_mode == TranscriptChallengeMode::SPLIT_SPONGE) {
+            for (size_t i = 0; i < num_challenges; i += 2) {
+                auto halves = TranscriptParams::split_challenge(get_next_sponge_output());
+                challenges[i] = TranscriptParams::template convert_challenge<ChallengeType>(halves[0]);
+                if (i + 1 < num_challenges) {
+                    challenges[i + 1] = TranscriptParams::template convert_challenge<ChallengeType>(halves[1]);
+                }
+            }
+            ++round_number;
+            return challenges;
+        }
+
         // Generate the challenges by iteratively hashing over the previous challenge.
         for (size_t i = 0; i < num_challenges; i++) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/741): Optimize this by truncating hash to 128
@@ -377,6 +455,8 @@ template <typename TranscriptParams> class BaseTranscript {
 
     [[nodiscard]] TranscriptManifest get_manifest() const { return manifest; };
 
+    [[nodiscard]] TranscriptChallengeMode get_challenge_mode() const { return challenge_mode; };
+
     void print() { manifest.print(); }
 };
 
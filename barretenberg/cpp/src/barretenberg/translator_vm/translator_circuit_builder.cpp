@@ -8,6 +8,7 @@
  *
  */
 #include "translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -372,25 +373,74 @@ TranslatorCircuitBuilder::AccumulationInput generate_witness_values(Fr op_code,
  * @param acc_step
  */
 void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput acc_step)
+{
+    const auto [row_index, first_variable_index] = allocate_accumulation_gates(1);
+    populate_accumulation_gate(acc_step, row_index, first_variable_index);
+}
+
+/**
+ * @brief Append the rows and variables of `num_accumulation_gates` accumulation gates, to be filled in by
+ * populate_accumulation_gate
+ *
+ * @details Each new variable is in its own copy cycle, as if it had been created with add_variable
+ *
+ * @return The index of the first new row and of the first new variable
+ */
+std::pair<size_t, uint32_t> TranslatorCircuitBuilder::allocate_accumulation_gates(const size_t num_accumulation_gates)
+{
+    const size_t row_index = num_gates;
+    const size_t first_variable_index = variables.size();
+    const size_t num_variables = first_variable_index + num_accumulation_gates * NUM_VARIABLES_PER_ACCUMULATION_GATE;
+
+    variables.resize(num_variables);
+    variable_classes.resize(num_variables);
+    real_variable_tags.resize(num_variables, DUMMY_TAG);
+
+    num_gates += num_accumulation_gates * 2;
+    for (auto& wire : wires) {
+        wire.resize(num_gates);
+    }
+    return { row_index, static_cast<uint32_t>(first_variable_index) };
+}
+
+/**
+ * @brief Write the witness of one accumulation step into rows and variables previously reserved with
+ * allocate_accumulation_gates
+ *
+ * @details Only touches the 2 rows starting at `row_index` and the NUM_VARIABLES_PER_ACCUMULATION_GATE variables
+ * starting at `first_variable_index`, so distinct gates can be populated concurrently.
+ */
+void TranslatorCircuitBuilder::populate_accumulation_gate(const AccumulationInput& acc_step,
+                                                          const size_t row_index,
+                                                          const uint32_t first_variable_index)
 {
     // The first wires OpQueue/Transcript wires
     // Opcode should be {0,1,2,3,4,8}
     ASSERT(acc_step.op_code == 0 || acc_step.op_code == 1 || acc_step.op_code == 2 || acc_step.op_code == 3 ||
            acc_step.op_code == 4 || acc_step.op_code == 8);
 
-    auto& op_wire = std::get<WireIds::OP>(wires);
-    op_wire.push_back(add_variable(acc_step.op_code));
+    uint32_t next_variable_index = first_variable_index;
+    /**
+     * @brief Set the value in a row (0 or 1) of the gate in the given wire to a new variable
+     *
+     */
+    auto put_into_wire = [&](size_t wire_index, size_t relative_row_index, const Fr& value) {
+        variables[next_variable_index] = value;
+        wires[wire_index][row_index + relative_row_index] = next_variable_index;
+        next_variable_index++;
+    };
+
+    put_into_wire(WireIds::OP, 0, acc_step.op_code);
     // Every second op value in the transcript (indices 3, 5, etc) are not defined so let's just put zero there
-    op_wire.push_back(zero_idx);
+    wires[WireIds::OP][row_index + 1] = zero_idx;
 
     /**
      * @brief Insert two values into the same wire sequentially
      *
      */
-    auto insert_pair_into_wire = [this](WireIds wire_index, Fr first, Fr second) {
-        auto& current_wire = wires[wire_index];
-        current_wire.push_back(add_variable(first));
-        current_wire.push_back(add_variable(second));
+    auto insert_pair_into_wire = [&](WireIds wire_index, const Fr& first, const Fr& second) {
+        put_into_wire(wire_index, 0, first);
+        put_into_wire(wire_index, 1, second);
     };
 
     // Check and insert P_x_lo and P_y_hi into wire 1
@@ -481,13 +531,15 @@ void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput
      * @brief Put several values in sequential wires
      *
      */
-    auto lay_limbs_in_row =
-        [this]<size_t array_size>(std::array<Fr, array_size> input, WireIds starting_wire, size_t number_of_elements) {
-            ASSERT(number_of_elements <= array_size);
-            for (size_t i = 0; i < number_of_elements; i++) {
-                wires[starting_wire + i].push_back(add_variable(input[i]));
-            }
-        };
+    auto lay_limbs_in_row = [&]<size_t array_size>(const std::array<Fr, array_size>& input,
+                                                   WireIds starting_wire,
+                                                   size_t number_of_elements,
+                                                   size_t relative_row_index) {
+        ASSERT(number_of_elements <= array_size);
+        for (size_t i = 0; i < number_of_elements; i++) {
+            put_into_wire(starting_wire + i, relative_row_index, input[i]);
+        }
+    };
 
     // We are using some leftover crevices for relation_wide_microlimbs
     auto low_relation_microlimbs = acc_step.relation_wide_microlimbs[0];
@@ -522,36 +574,35 @@ void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput
     top_quotient_microlimbs[NUM_MICRO_LIMBS - 1] = high_relation_microlimbs[NUM_MICRO_LIMBS - 1];
 
     // Now put all microlimbs into appropriate wires
-    lay_limbs_in_row(acc_step.P_x_microlimbs[0], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_x_microlimbs[1], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_x_microlimbs[2], P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_p_x_microlimbs, P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[0], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[1], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[2], P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_p_y_microlimbs, P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_1_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_2_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_1_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_2_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.current_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS);
-    lay_limbs_in_row(acc_step.previous_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[0], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[1], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[2], P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(top_p_x_microlimbs, P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[0], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[1], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[2], P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(top_p_y_microlimbs, P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.z_1_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(acc_step.z_2_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.z_1_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(acc_step.z_2_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.current_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS, 0);
+    lay_limbs_in_row(acc_step.previous_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS, 1);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[0], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
+        acc_step.current_accumulator_microlimbs[0], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[1], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
+        acc_step.current_accumulator_microlimbs[1], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[2], ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_current_accumulator_microlimbs, ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[0], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[1], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[2], QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_quotient_microlimbs, QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-
-    num_gates += 2;
-
-    // Check that all the wires are filled equally
-    bb::constexpr_for<0, TOTAL_COUNT, 1>([&]<size_t i>() { ASSERT(std::get<i>(wires).size() == num_gates); });
+        acc_step.current_accumulator_microlimbs[2], ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(
+        top_current_accumulator_microlimbs, ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[0], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[1], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, 1);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[2], QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, 0);
+    lay_limbs_in_row(top_quotient_microlimbs, QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, 1);
+
+    // Check that we have used exactly the variables reserved for this gate
+    ASSERT(next_variable_index == first_variable_index + NUM_VARIABLES_PER_ACCUMULATION_GATE);
 }
 
 /**
@@ -610,7 +661,9 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
     auto v = batching_challenge_v;
 
     // We need to precompute the accumulators at each step, because in the actual circuit we compute the values starting
-    // from the later indices. We need to know the previous accumulator to create the gate
+    // from the later indices. We need to know the previous accumulator to create the gate. This native scan is cheap
+    // compared to the witness generation below, which only depends on it and can then be done for all ops in parallel.
+    accumulator_trace.reserve(raw_ops.size());
     for (size_t i = 0; i < raw_ops.size(); i++) {
         const auto& ecc_op = raw_ops[raw_ops.size() - 1 - i];
         current_accumulator *= x;
@@ -620,22 +673,22 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
         accumulator_trace.push_back(current_accumulator);
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
-
-    for (const auto& raw_op : raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
-        }
+    // Reserve the rows and variables of all the gates, then compute the witness of each op (limb decompositions,
+    // quotient, relation limbs and microlimbs) and write it directly into its own rows.
+    // We don't care about the last value of the accumulator trace since we'll recompute it during witness generation
+    // anyway: the i-th op's previous accumulator is the accumulation of all the ops after it.
+    const auto [first_row_index, first_variable_index] = allocate_accumulation_gates(raw_ops.size());
+    parallel_for(raw_ops.size(), [&](size_t i) {
+        const Fq previous_accumulator = (i + 1 < raw_ops.size()) ? accumulator_trace[raw_ops.size() - 2 - i] : Fq(0);
         // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
+        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_ops[i], previous_accumulator, v, x);
 
         // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
-    }
+        populate_accumulation_gate(one_accumulation_step,
+                                   first_row_index + 2 * i,
+                                   first_variable_index +
+                                       static_cast<uint32_t>(i * NUM_VARIABLES_PER_ACCUMULATION_GATE));
+    });
 }
 bool TranslatorCircuitBuilder::check_circuit()
 {
@@ -186,6 +186,9 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
     // the permutation argument)
     static constexpr size_t DEFAULT_TRANSLATOR_VM_LENGTH = 2048;
 
+    // Every wire gets 2 new variables per accumulation gate, except for the second op row which is always zero_idx
+    static constexpr size_t NUM_VARIABLES_PER_ACCUMULATION_GATE = 2 * TOTAL_COUNT - 1;
+
     // Maximum size of a single limb is 68 bits
     static constexpr size_t NUM_LIMB_BITS = 68;
 
@@ -424,6 +427,12 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
      */
     void create_accumulation_gate(AccumulationInput acc_step);
 
+    std::pair<size_t, uint32_t> allocate_accumulation_gates(size_t num_accumulation_gates);
+
+    void populate_accumulation_gate(const AccumulationInput& acc_step,
+                                    size_t row_index,
+                                    uint32_t first_variable_index);
+
     /**
      * @brief Get the result of accumulation
      *
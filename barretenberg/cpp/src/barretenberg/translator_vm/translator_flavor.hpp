@@ -800,6 +800,7 @@ class TranslatorFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
         // Set all shifted polynomials based on their to-be-shifted counterpart
         void set_shifted()
         {
@@ -27,6 +27,7 @@ DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<Instance>& inst,
  */
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_check_rounds()
 {
+    BB_OP_COUNT_TIME_NAME("Decider::execute_relation_check_rounds");
     using Sumcheck = SumcheckProver<Flavor>;
     auto instance_size = accumulator->proving_key.circuit_size;
     auto sumcheck = Sumcheck(instance_size, transcript);
@@ -40,6 +41,7 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
  * */
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_zeromorph_rounds()
 {
+    BB_OP_COUNT_TIME_NAME("Decider::execute_zeromorph_rounds");
     ZeroMorph::prove(accumulator->proving_key.polynomials.get_unshifted(),
                      accumulator->proving_key.polynomials.get_to_be_shifted(),
                      sumcheck_output.claimed_evaluations.get_unshifted(),
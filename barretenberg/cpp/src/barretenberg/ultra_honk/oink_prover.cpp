@@ -1,4 +1,5 @@
 #include "barretenberg/ultra_honk/oink_prover.hpp"
+#include "barretenberg/common/op_count.hpp"
 
 namespace bb {
 
@@ -10,6 +11,7 @@ namespace bb {
  */
 template <IsUltraFlavor Flavor> OinkProverOutput<Flavor> OinkProver<Flavor>::prove()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::prove");
     // Add circuit size public input size and public inputs to transcript->
     execute_preamble_round();
 
@@ -41,6 +43,7 @@ template <IsUltraFlavor Flavor> OinkProverOutput<Flavor> OinkProver<Flavor>::pro
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_preamble_round()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::execute_preamble_round");
     const auto circuit_size = static_cast<uint32_t>(proving_key.circuit_size);
     const auto num_public_inputs = static_cast<uint32_t>(proving_key.num_public_inputs);
     transcript->send_to_verifier(domain_separator + "circuit_size", circuit_size);
@@ -63,6 +66,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_preamble_round(
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::execute_wire_commitments_round");
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
     witness_commitments.w_l = commitment_key->commit(proving_key.polynomials.w_l);
@@ -109,7 +113,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_accumulator_round()
 {
-
+    BB_OP_COUNT_TIME_NAME("OinkProver::execute_sorted_list_accumulator_round");
     auto [eta, eta_two, eta_three] = transcript->template get_challenges<FF>(
         domain_separator + "eta", domain_separator + "eta_two", domain_separator + "eta_three");
     relation_parameters.eta = eta;
@@ -133,6 +137,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_inverse_round()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::execute_log_derivative_inverse_round");
     auto [beta, gamma] = transcript->template get_challenges<FF>(domain_separator + "beta", domain_separator + "gamma");
     relation_parameters.beta = beta;
     relation_parameters.gamma = gamma;
@@ -155,6 +160,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::execute_grand_product_computation_round");
     proving_key.compute_grand_product_polynomials(relation_parameters);
 
     witness_commitments.z_perm = commitment_key->commit(proving_key.polynomials.z_perm);
@@ -166,6 +172,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
 
 template <IsUltraFlavor Flavor> typename Flavor::RelationSeparator OinkProver<Flavor>::generate_alphas_round()
 {
+    BB_OP_COUNT_TIME_NAME("OinkProver::generate_alphas_round");
     RelationSeparator alphas;
     for (size_t idx = 0; idx < alphas.size(); idx++) {
         alphas[idx] = transcript->template get_challenge<FF>(domain_separator + "alpha_" + std::to_string(idx));
@@ -8,6 +8,7 @@
 #include "barretenberg/relations/lookup_relation.hpp"
 #include "barretenberg/relations/permutation_relation.hpp"
 #include "barretenberg/relations/ultra_arithmetic_relation.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/fixed_base/fixed_base.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -23,18 +24,14 @@ class SumcheckTestsRealCircuit : public ::testing::Test {
     static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
 };
 
+namespace {
 /**
- * @brief Test the Ultra Sumcheck Prover and Verifier for a real circuit
+ * @brief Construct a circuit using each of the Ultra gate types
  *
  */
-TEST_F(SumcheckTestsRealCircuit, Ultra)
+UltraCircuitBuilder construct_ultra_circuit()
 {
-    using Flavor = UltraFlavor;
-    using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
-    using RelationSeparator = typename Flavor::RelationSeparator;
-
-    // Create a composer and a dummy circuit with a few gates
+    // Create a dummy circuit with a few gates
     auto builder = UltraCircuitBuilder();
     FF a = FF::one();
 
@@ -146,9 +143,15 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
         },
         false);
 
-    // Create a prover (it will compute proving key and witness)
-    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+    return builder;
+}
 
+/**
+ * @brief Set the relation parameters of the instance and compute the polynomials depending on them
+ *
+ */
+void compute_instance_witness(const std::shared_ptr<ProverInstance_<Flavor>>& instance)
+{
     // Generate eta, beta and gamma
     instance->relation_parameters.eta = FF::random_element();
     instance->relation_parameters.eta = FF::random_element();
@@ -161,6 +164,27 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
                                                                  instance->relation_parameters.eta_two,
                                                                  instance->relation_parameters.eta_three);
     instance->proving_key.compute_grand_product_polynomials(instance->relation_parameters);
+}
+} // namespace
+
+/**
+ * @brief Test the Ultra Sumcheck Prover and Verifier for a real circuit
+ *
+ */
+TEST_F(SumcheckTestsRealCircuit, Ultra)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using Transcript = typename Flavor::Transcript;
+    using RelationSeparator = typename Flavor::RelationSeparator;
+
+    // Create a dummy circuit with a few gates
+    auto builder = construct_ultra_circuit();
+
+    // Create a prover (it will compute proving key and witness)
+    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+
+    compute_instance_witness(instance);
 
     auto prover_transcript = Transcript::prover_init_empty();
     auto circuit_size = instance->proving_key.circuit_size;
@@ -201,3 +225,46 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
 
     ASSERT_TRUE(verified);
 }
+
+/**
+ * @brief Check that skipping the rows outside of the blocks of a structured trace does not change the sumcheck proof
+ *
+ */
+TEST_F(SumcheckTestsRealCircuit, UltraStructuredTraceActiveRows)
+{
+    using Transcript = typename Flavor::Transcript;
+
+    // The structured trace does not reserve space for lookup tables, so use a circuit without lookups
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10);
+    bool structured = true;
+    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder, structured);
+    compute_instance_witness(instance);
+
+    auto circuit_size = instance->proving_key.circuit_size;
+    auto log_circuit_size = numeric::get_msb(circuit_size);
+    for (auto& alpha : instance->alphas) {
+        alpha = FF::random_element();
+    }
+    instance->gate_challenges.resize(log_circuit_size);
+    for (auto& gate_challenge : instance->gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+
+    // The instance has active row ranges, so this only processes the edges meeting them
+    EXPECT_FALSE(instance->proving_key.active_row_ranges.empty());
+    auto transcript = Transcript::prover_init_empty();
+    auto sumcheck_prover = SumcheckProver<Flavor>(circuit_size, transcript);
+    auto output = sumcheck_prover.prove(instance);
+
+    // Process every edge of the hypercube
+    auto full_transcript = Transcript::prover_init_empty();
+    auto full_sumcheck_prover = SumcheckProver<Flavor>(circuit_size, full_transcript);
+    auto full_output = full_sumcheck_prover.prove(instance->proving_key.polynomials,
+                                                  instance->relation_parameters,
+                                                  instance->alphas,
+                                                  instance->gate_challenges);
+
+    EXPECT_EQ(transcript->proof_data, full_transcript->proof_data);
+    EXPECT_EQ(output.challenge, full_output.challenge);
+}
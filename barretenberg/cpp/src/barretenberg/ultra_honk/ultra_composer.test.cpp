@@ -120,6 +120,28 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief A proof generated with the SPLIT_SPONGE challenge mode only verifies in that mode
+ *
+ */
+TEST_F(UltraHonkComposerTests, SplitSpongeTranscript)
+{
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10);
+
+    auto instance = std::make_shared<ProverInstance>(builder);
+    UltraProver prover(instance, std::make_shared<UltraFlavor::Transcript>(TranscriptChallengeMode::SPLIT_SPONGE));
+    auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+    auto proof = prover.construct_proof();
+
+    UltraVerifier verifier(std::make_shared<UltraFlavor::Transcript>(TranscriptChallengeMode::SPLIT_SPONGE),
+                           verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    UltraVerifier default_verifier(verification_key);
+    EXPECT_FALSE(default_verifier.verify_proof(proof));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -27,16 +27,19 @@ UltraVerifier_<Flavor>::UltraVerifier_(const std::shared_ptr<VerificationKey>& v
 template <typename Flavor>
 UltraVerifier_<Flavor>::UltraVerifier_(UltraVerifier_&& other)
     : key(std::move(other.key))
+    , transcript(std::move(other.transcript))
 {}
 
 template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::operator=(UltraVerifier_&& other)
 {
     key = other.key;
+    transcript = std::move(other.transcript);
     return *this;
 }
 
 /**
  * @brief This function verifies an Ultra Honk proof for a given Flavor.
+ * @details The proof is read with the challenge mode of the transcript the verifier was constructed with.
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
@@ -46,7 +49,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
     using ZeroMorph = ZeroMorphVerifier_<PCS>;
     using VerifierCommitments = typename Flavor::VerifierCommitments;
 
-    transcript = std::make_shared<Transcript>(proof);
+    transcript = std::make_shared<Transcript>(proof, transcript->get_challenge_mode());
     VerifierCommitments commitments{ key };
     OinkVerifier<Flavor> oink_verifier{ key, transcript };
     auto [relation_parameters, witness_commitments, _, alphas] = oink_verifier.verify();
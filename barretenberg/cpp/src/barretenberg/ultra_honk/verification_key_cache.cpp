@@ -0,0 +1,109 @@
+#include "verification_key_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#ifndef __wasm__
+#include <filesystem>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+VerificationKeyCache::VerificationKeyCache(std::string directory)
+    : directory(std::move(directory))
+{
+#ifndef __wasm__
+    std::error_code error;
+    std::filesystem::create_directories(this->directory, error);
+#endif
+}
+
+std::string VerificationKeyCache::get_path(const std::string& key) const
+{
+    return directory + "/" + key + ".vk";
+}
+
+std::optional<std::vector<uint8_t>> VerificationKeyCache::read_file(const std::string& key) const
+{
+#ifdef __wasm__
+    static_cast<void>(key);
+    return std::nullopt;
+#else
+    std::ifstream file(get_path(key), std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const size_t checksum_size = sizeof(crypto::Sha256Hash);
+    if (contents.size() < checksum_size) {
+        return std::nullopt;
+    }
+    const auto checksum_end = contents.begin() + static_cast<std::ptrdiff_t>(checksum_size);
+    std::vector<uint8_t> buffer(checksum_end, contents.end());
+    if (!std::equal(contents.begin(), checksum_end, crypto::sha256(buffer).begin())) {
+        info("ignoring verification key cache file with bad checksum at ", get_path(key));
+        return std::nullopt;
+    }
+    return buffer;
+#endif
+}
+
+void VerificationKeyCache::write_file(const std::string& key, const std::vector<uint8_t>& buffer) const
+{
+#ifdef __wasm__
+    static_cast<void>(key);
+    static_cast<void>(buffer);
+#else
+    const std::string path = get_path(key);
+    std::stringstream tmp_path;
+    tmp_path << path << ".tmp." << getpid() << "." << std::this_thread::get_id();
+    {
+        std::ofstream file(tmp_path.str(), std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return;
+        }
+        const auto checksum = crypto::sha256(buffer);
+        file.write(reinterpret_cast<const char*>(checksum.data()), static_cast<std::streamsize>(checksum.size()));
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            std::remove(tmp_path.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.str().c_str());
+    }
+#endif
+}
+
+std::string VerificationKeyCache::to_hex(const crypto::Sha256Hash& hash)
+{
+    std::stringstream ss;
+    ss << hash;
+    return ss.str();
+}
+
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex verification_key_cache_mutex;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::shared_ptr<VerificationKeyCache> verification_key_cache;
+} // namespace
+
+void init_verification_key_cache(const std::string& directory)
+{
+    std::unique_lock<std::mutex> lock(verification_key_cache_mutex);
+    verification_key_cache = std::make_shared<VerificationKeyCache>(directory);
+}
+
+std::shared_ptr<VerificationKeyCache> get_verification_key_cache()
+{
+    std::unique_lock<std::mutex> lock(verification_key_cache_mutex);
+    return verification_key_cache;
+}
+
+} // namespace bb
@@ -0,0 +1,154 @@
+#pragma once
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief An on-disk cache of Honk verification keys, keyed by the content of the proving key they are derived from
+ *
+ * @details Deriving a verification key from a proving key costs one MSM per precomputed polynomial (selectors,
+ * permutation and identity polynomials, lookup tables and lagrange polynomials). The key is a deterministic function
+ * of those polynomials, the circuit size, number of public inputs and public input offset, the flavor and the CRS the
+ * commitments are computed against, so we cache it under a SHA-256 hash of exactly that data. The CRS enters through a
+ * fingerprint of its first G1 monomial points and its G2 point. Repeated proofs of the same circuit then only pay for
+ * the (parallel) hashing.
+ *
+ * Each cached key is stored as `<directory>/<hash>.vk`, holding the SHA-256 of the serialized key followed by the
+ * serialized key itself. Files with a bad checksum are ignored and overwritten; files are written to a temporary path
+ * and renamed into place, so processes sharing a directory never observe a partially written key.
+ */
+class VerificationKeyCache {
+  public:
+    // Bump whenever the serialization of the verification keys or the way keys are hashed changes
+    static constexpr uint32_t VERSION = 2;
+    // The number of leading G1 monomial points of the CRS hashed into its fingerprint
+    static constexpr size_t NUM_CRS_FINGERPRINT_POINTS = 8;
+
+    explicit VerificationKeyCache(std::string directory);
+
+    /**
+     * @brief Return the verification key of `proving_key`, from the cache if present, else computed and then cached
+     */
+    template <typename Flavor>
+    std::shared_ptr<typename Flavor::VerificationKey> get_or_compute(typename Flavor::ProvingKey& proving_key)
+    {
+        using VerificationKey = typename Flavor::VerificationKey;
+        using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
+
+        const std::string key = compute_key<Flavor>(proving_key);
+        if (auto buffer = read_file(key)) {
+            num_hits++;
+            auto verification_key = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(*buffer));
+            verification_key->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+            return verification_key;
+        }
+        num_misses++;
+        auto verification_key = std::make_shared<VerificationKey>(proving_key);
+        write_file(key, to_buffer(*verification_key));
+        return verification_key;
+    }
+
+    /**
+     * @brief Hash the data the verification key of `proving_key` is derived from
+     * @details The precomputed polynomials are hashed in chunks in parallel; the returned key is the hex SHA-256 of the
+     * cache version, the flavor, a fingerprint of the CRS, the size metadata and the chunk digests.
+     */
+    template <typename Flavor> static std::string compute_key(typename Flavor::ProvingKey& proving_key)
+    {
+        using FF = typename Flavor::FF;
+        constexpr size_t CHUNK_SIZE = 1 << 16;
+
+        std::vector<std::span<const uint8_t>> chunks;
+        for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(polynomial.begin());
+            for (size_t start = 0; start < polynomial.size(); start += CHUNK_SIZE) {
+                const size_t chunk_size = std::min(CHUNK_SIZE, polynomial.size() - start);
+                chunks.emplace_back(bytes + start * sizeof(FF), chunk_size * sizeof(FF));
+            }
+        }
+        std::vector<crypto::Sha256Hash> chunk_hashes(chunks.size());
+        parallel_for(chunks.size(), [&](size_t i) { chunk_hashes[i] = crypto::sha256(chunks[i]); });
+
+        std::vector<uint8_t> preimage;
+        serialize::write(preimage, VERSION);
+        const std::string_view flavor_name = typeid(Flavor).name();
+        serialize::write(preimage, static_cast<uint64_t>(flavor_name.size()));
+        preimage.insert(preimage.end(), flavor_name.begin(), flavor_name.end());
+        serialize::write(preimage, static_cast<uint64_t>(Flavor::NUM_PRECOMPUTED_ENTITIES));
+        write_crs_fingerprint<Flavor>(preimage, proving_key);
+        serialize::write(preimage, static_cast<uint64_t>(proving_key.circuit_size));
+        serialize::write(preimage, static_cast<uint64_t>(proving_key.num_public_inputs));
+        serialize::write(preimage, static_cast<uint64_t>(proving_key.pub_inputs_offset));
+        for (const auto& chunk_hash : chunk_hashes) {
+            preimage.insert(preimage.end(), chunk_hash.begin(), chunk_hash.end());
+        }
+        return to_hex(crypto::sha256(preimage));
+    }
+
+    size_t get_num_hits() const { return num_hits; }
+    size_t get_num_misses() const { return num_misses; }
+
+  private:
+    std::string directory;
+
+    template <typename Flavor>
+    static void write_crs_fingerprint(std::vector<uint8_t>& preimage, typename Flavor::ProvingKey& proving_key)
+    {
+        using Curve = typename Flavor::Curve;
+        auto& srs = proving_key.commitment_key->srs;
+        // The monomial points are stored interleaved with their endomorphism images
+        const size_t num_points = std::min(2 * NUM_CRS_FINGERPRINT_POINTS, 2 * srs->get_monomial_size());
+        const auto* points = srs->get_monomial_points();
+        for (size_t i = 0; i < num_points; ++i) {
+            serialize::write(preimage, points[i]);
+        }
+        if constexpr (std::same_as<Curve, curve::BN254>) {
+            serialize::write(preimage, srs::get_crs_factory<Curve>()->get_verifier_crs()->get_g2x());
+        }
+    }
+
+    std::atomic<size_t> num_hits = 0;
+    std::atomic<size_t> num_misses = 0;
+
+    std::string get_path(const std::string& key) const;
+    std::optional<std::vector<uint8_t>> read_file(const std::string& key) const;
+    void write_file(const std::string& key, const std::vector<uint8_t>& buffer) const;
+
+    static std::string to_hex(const crypto::Sha256Hash& hash);
+};
+
+/**
+ * @brief Enable the global verification key cache used by compute_verification_key, storing keys in `directory`
+ */
+void init_verification_key_cache(const std::string& directory);
+
+/**
+ * @brief The global verification key cache, or nullptr if init_verification_key_cache has not been called
+ */
+std::shared_ptr<VerificationKeyCache> get_verification_key_cache();
+
+/**
+ * @brief Compute the verification key of a proving key, through the global verification key cache if it is enabled
+ */
+template <typename Flavor>
+std::shared_ptr<typename Flavor::VerificationKey> compute_verification_key(typename Flavor::ProvingKey& proving_key)
+{
+    if (auto cache = get_verification_key_cache()) {
+        return cache->template get_or_compute<Flavor>(proving_key);
+    }
+    return std::make_shared<typename Flavor::VerificationKey>(proving_key);
+}
+
+} // namespace bb
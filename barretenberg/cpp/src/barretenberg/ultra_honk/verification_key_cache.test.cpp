@@ -0,0 +1,136 @@
+#include "barretenberg/ultra_honk/verification_key_cache.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+class VerificationKeyCacheTests : public ::testing::Test {
+  protected:
+    using Flavor = UltraFlavor;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() /
+                    ("bb_vk_cache_test_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    static std::shared_ptr<ProverInstance> create_instance(size_t log2_num_gates)
+    {
+        UltraCircuitBuilder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        return std::make_shared<ProverInstance>(builder);
+    }
+
+    static void expect_equal(const VerificationKey& lhs, const VerificationKey& rhs)
+    {
+        EXPECT_EQ(lhs.circuit_size, rhs.circuit_size);
+        EXPECT_EQ(lhs.num_public_inputs, rhs.num_public_inputs);
+        EXPECT_EQ(lhs.pub_inputs_offset, rhs.pub_inputs_offset);
+        for (auto [lhs_commitment, rhs_commitment] : zip_view(lhs.get_all(), rhs.get_all())) {
+            EXPECT_EQ(lhs_commitment, rhs_commitment);
+        }
+    }
+
+    std::filesystem::path directory;
+};
+
+/**
+ * @brief A cached verification key is identical to a freshly computed one and verifies proofs
+ */
+TEST_F(VerificationKeyCacheTests, HitMatchesComputedKey)
+{
+    VerificationKeyCache cache(directory);
+
+    auto instance = create_instance(10);
+    VerificationKey expected_vk(instance->proving_key);
+    auto missed_vk = cache.get_or_compute<Flavor>(instance->proving_key);
+    EXPECT_EQ(cache.get_num_hits(), 0U);
+    EXPECT_EQ(cache.get_num_misses(), 1U);
+
+    // A new cache on the same directory, as in a later process, finds the key
+    VerificationKeyCache later_cache(directory);
+    auto same_instance = create_instance(10);
+    auto hit_vk = later_cache.get_or_compute<Flavor>(same_instance->proving_key);
+    EXPECT_EQ(later_cache.get_num_hits(), 1U);
+    EXPECT_EQ(later_cache.get_num_misses(), 0U);
+
+    expect_equal(*missed_vk, expected_vk);
+    expect_equal(*hit_vk, expected_vk);
+
+    UltraProver prover(same_instance);
+    auto proof = prover.construct_proof();
+    UltraVerifier verifier(hit_vk);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+/**
+ * @brief Different circuits have different keys, and a corrupted cache file is recomputed
+ */
+TEST_F(VerificationKeyCacheTests, DistinctCircuitsAndCorruption)
+{
+    VerificationKeyCache cache(directory);
+
+    auto instance = create_instance(10);
+    auto other_instance = create_instance(11);
+    const auto key = VerificationKeyCache::compute_key<Flavor>(instance->proving_key);
+    EXPECT_NE(key, VerificationKeyCache::compute_key<Flavor>(other_instance->proving_key));
+
+    cache.get_or_compute<Flavor>(instance->proving_key);
+    cache.get_or_compute<Flavor>(other_instance->proving_key);
+    EXPECT_EQ(cache.get_num_misses(), 2U);
+
+    // Flip a byte of the serialized key
+    const auto path = directory / (key + ".vk");
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(-1, std::ios::end);
+    const char last = static_cast<char>(file.get());
+    file.seekp(-1, std::ios::end);
+    file.put(static_cast<char>(last ^ 1));
+    file.close();
+
+    auto recomputed_vk = cache.get_or_compute<Flavor>(instance->proving_key);
+    EXPECT_EQ(cache.get_num_hits(), 0U);
+    EXPECT_EQ(cache.get_num_misses(), 3U);
+    expect_equal(*recomputed_vk, VerificationKey(instance->proving_key));
+}
+
+/**
+ * @brief The same circuit committed against a different CRS misses the cache
+ */
+TEST_F(VerificationKeyCacheTests, ChangedCrsMisses)
+{
+    VerificationKeyCache cache(directory);
+
+    auto instance = create_instance(10);
+    const auto key = VerificationKeyCache::compute_key<Flavor>(instance->proving_key);
+    cache.get_or_compute<Flavor>(instance->proving_key);
+
+    // Copy the CRS the proving key was committed against, changing its first point
+    auto& srs = instance->proving_key.commitment_key->srs;
+    std::vector<g1::affine_element> points(srs->get_monomial_size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i] = srs->get_monomial_points()[2 * i]; // skip the interleaved endomorphism points
+    }
+    points[0] = g1::affine_element(g1::element(points[0]).dbl());
+    instance->proving_key.commitment_key = std::make_shared<CommitmentKey<curve::BN254>>(
+        points.size(), std::make_shared<srs::factories::MemProverCrs<curve::BN254>>(points));
+
+    EXPECT_NE(key, VerificationKeyCache::compute_key<Flavor>(instance->proving_key));
+    cache.get_or_compute<Flavor>(instance->proving_key);
+    EXPECT_EQ(cache.get_num_hits(), 0U);
+    EXPECT_EQ(cache.get_num_misses(), 2U);
+}
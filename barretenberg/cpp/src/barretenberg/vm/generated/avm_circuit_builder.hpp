@@ -4,10 +4,8 @@
 #pragma once
 
 #include <vector>
-#ifndef __wasm__
-#include <future>
-#endif
 
+#include "barretenberg/circuit_checker/trace_checker.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -772,7 +770,30 @@ class AvmCircuitBuilder {
         return polys;
     }
 
+    /**
+     * @brief Check that every relation and lookup holds on the trace
+     * @details Throws (through throw_or_abort) on the first failing (relation, row), in the order the relations are
+     * listed below. Use `check_circuit_report` to get all failures instead.
+     */
     [[maybe_unused]] bool check_circuit()
+    {
+        const auto failures = evaluate_check_circuit(/*stop_at_first_failure=*/true);
+        if (!failures.empty()) {
+            throw_or_abort(failures.front().message());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Evaluate every relation and lookup on the trace and return all failing (relation, row) pairs
+     */
+    std::vector<TraceCheckFailure> check_circuit_report()
+    {
+        return evaluate_check_circuit(/*stop_at_first_failure=*/false);
+    }
+
+    std::vector<TraceCheckFailure> evaluate_check_circuit(bool stop_at_first_failure)
     {
 
         const FF gamma = FF::random_element();
@@ -791,488 +812,61 @@ class AvmCircuitBuilder {
         auto polys = compute_polynomials();
         const size_t num_rows = polys.get_polynomial_size();
 
-        const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name,
-                                                              std::string (*debug_label)(int)) {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result;
-            for (auto& r : result) {
-                r = 0;
-            }
-            constexpr size_t NUM_SUBRELATIONS = result.size();
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                Relation::accumulate(result, polys.get_row(i), {}, 1);
-
-                bool x = true;
-                for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
-                    if (result[j] != 0) {
-                        std::string row_name = debug_label(static_cast<int>(j));
-                        throw_or_abort(
-                            format("Relation ", relation_name, ", subrelation index ", row_name, " failed at row ", i));
-                        x = false;
-                    }
-                }
-                if (!x) {
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        const auto evaluate_logderivative = [&]<typename LogDerivativeSettings>(const std::string& lookup_name) {
-            // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, LogDerivativeSettings>(polys, params, num_rows);
-
-            typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations lookup_result;
-
-            for (auto& r : lookup_result) {
-                r = 0;
-            }
-            for (size_t i = 0; i < num_rows; ++i) {
-                LogDerivativeSettings::accumulate(lookup_result, polys.get_row(i), params, 1);
-            }
-            for (auto r : lookup_result) {
-                if (r != 0) {
-                    throw_or_abort(format("Lookup ", lookup_name, " failed."));
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        auto avm_alu = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::avm_alu<FF>>("avm_alu",
-                                                                              Avm_vm::get_relation_label_avm_alu);
-        };
-
-        auto avm_binary = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::avm_binary<FF>>("avm_binary",
-                                                                                 Avm_vm::get_relation_label_avm_binary);
-        };
-
-        auto avm_conversion = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::avm_conversion<FF>>(
-                "avm_conversion", Avm_vm::get_relation_label_avm_conversion);
-        };
-
-        auto avm_main = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::avm_main<FF>>("avm_main",
-                                                                               Avm_vm::get_relation_label_avm_main);
-        };
-
-        auto avm_mem = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::avm_mem<FF>>("avm_mem",
-                                                                              Avm_vm::get_relation_label_avm_mem);
-        };
-
-        auto perm_main_alu = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_alu_relation<FF>>("PERM_MAIN_ALU");
-        };
-
-        auto perm_main_bin = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_bin_relation<FF>>("PERM_MAIN_BIN");
-        };
-
-        auto perm_main_conv = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_conv_relation<FF>>("PERM_MAIN_CONV");
-        };
-
-        auto perm_main_mem_a = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_a_relation<FF>>("PERM_MAIN_MEM_A");
-        };
-
-        auto perm_main_mem_b = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_b_relation<FF>>("PERM_MAIN_MEM_B");
-        };
-
-        auto perm_main_mem_c = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_c_relation<FF>>("PERM_MAIN_MEM_C");
-        };
-
-        auto perm_main_mem_d = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_d_relation<FF>>("PERM_MAIN_MEM_D");
-        };
-
-        auto perm_main_mem_ind_a = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_a_relation<FF>>("PERM_MAIN_MEM_IND_A");
-        };
-
-        auto perm_main_mem_ind_b = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_b_relation<FF>>("PERM_MAIN_MEM_IND_B");
-        };
-
-        auto perm_main_mem_ind_c = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_c_relation<FF>>("PERM_MAIN_MEM_IND_C");
-        };
-
-        auto perm_main_mem_ind_d = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_d_relation<FF>>("PERM_MAIN_MEM_IND_D");
-        };
-
-        auto lookup_byte_lengths = [=]() {
-            return evaluate_logderivative.template operator()<lookup_byte_lengths_relation<FF>>("LOOKUP_BYTE_LENGTHS");
-        };
-
-        auto lookup_byte_operations = [=]() {
-            return evaluate_logderivative.template operator()<lookup_byte_operations_relation<FF>>(
-                "LOOKUP_BYTE_OPERATIONS");
-        };
-
-        auto lookup_into_kernel = [=]() {
-            return evaluate_logderivative.template operator()<lookup_into_kernel_relation<FF>>("LOOKUP_INTO_KERNEL");
-        };
-
-        auto incl_main_tag_err = [=]() {
-            return evaluate_logderivative.template operator()<incl_main_tag_err_relation<FF>>("INCL_MAIN_TAG_ERR");
-        };
-
-        auto incl_mem_tag_err = [=]() {
-            return evaluate_logderivative.template operator()<incl_mem_tag_err_relation<FF>>("INCL_MEM_TAG_ERR");
-        };
-
-        auto lookup_mem_rng_chk_lo = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_lo_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_LO");
-        };
-
-        auto lookup_mem_rng_chk_mid = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_mid_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_MID");
-        };
-
-        auto lookup_mem_rng_chk_hi = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_hi_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_HI");
-        };
-
-        auto lookup_pow_2_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_pow_2_0_relation<FF>>("LOOKUP_POW_2_0");
-        };
-
-        auto lookup_pow_2_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_pow_2_1_relation<FF>>("LOOKUP_POW_2_1");
-        };
-
-        auto lookup_u8_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u8_0_relation<FF>>("LOOKUP_U8_0");
-        };
-
-        auto lookup_u8_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u8_1_relation<FF>>("LOOKUP_U8_1");
-        };
-
-        auto lookup_u16_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_0_relation<FF>>("LOOKUP_U16_0");
-        };
-
-        auto lookup_u16_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_1_relation<FF>>("LOOKUP_U16_1");
-        };
-
-        auto lookup_u16_2 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_2_relation<FF>>("LOOKUP_U16_2");
-        };
-
-        auto lookup_u16_3 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_3_relation<FF>>("LOOKUP_U16_3");
-        };
-
-        auto lookup_u16_4 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_4_relation<FF>>("LOOKUP_U16_4");
-        };
-
-        auto lookup_u16_5 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_5_relation<FF>>("LOOKUP_U16_5");
-        };
-
-        auto lookup_u16_6 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_6_relation<FF>>("LOOKUP_U16_6");
-        };
-
-        auto lookup_u16_7 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_7_relation<FF>>("LOOKUP_U16_7");
-        };
-
-        auto lookup_u16_8 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_8_relation<FF>>("LOOKUP_U16_8");
-        };
-
-        auto lookup_u16_9 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_9_relation<FF>>("LOOKUP_U16_9");
-        };
-
-        auto lookup_u16_10 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_10_relation<FF>>("LOOKUP_U16_10");
-        };
-
-        auto lookup_u16_11 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_11_relation<FF>>("LOOKUP_U16_11");
-        };
-
-        auto lookup_u16_12 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_12_relation<FF>>("LOOKUP_U16_12");
-        };
-
-        auto lookup_u16_13 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_13_relation<FF>>("LOOKUP_U16_13");
-        };
-
-        auto lookup_u16_14 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_14_relation<FF>>("LOOKUP_U16_14");
-        };
-
-        auto lookup_div_u16_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_0_relation<FF>>("LOOKUP_DIV_U16_0");
-        };
-
-        auto lookup_div_u16_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_1_relation<FF>>("LOOKUP_DIV_U16_1");
-        };
-
-        auto lookup_div_u16_2 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_2_relation<FF>>("LOOKUP_DIV_U16_2");
-        };
-
-        auto lookup_div_u16_3 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_3_relation<FF>>("LOOKUP_DIV_U16_3");
-        };
-
-        auto lookup_div_u16_4 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_4_relation<FF>>("LOOKUP_DIV_U16_4");
-        };
-
-        auto lookup_div_u16_5 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_5_relation<FF>>("LOOKUP_DIV_U16_5");
-        };
-
-        auto lookup_div_u16_6 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_6_relation<FF>>("LOOKUP_DIV_U16_6");
-        };
-
-        auto lookup_div_u16_7 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_7_relation<FF>>("LOOKUP_DIV_U16_7");
-        };
-
-#ifndef __wasm__
-
-        // Evaluate check circuit closures as futures
-        std::vector<std::future<bool>> relation_futures;
-
-        relation_futures.emplace_back(std::async(std::launch::async, avm_alu));
-
-        relation_futures.emplace_back(std::async(std::launch::async, avm_binary));
-
-        relation_futures.emplace_back(std::async(std::launch::async, avm_conversion));
-
-        relation_futures.emplace_back(std::async(std::launch::async, avm_main));
-
-        relation_futures.emplace_back(std::async(std::launch::async, avm_mem));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_alu));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_bin));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_conv));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_a));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_b));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_c));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_d));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_a));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_b));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_c));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_d));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_byte_lengths));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_byte_operations));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_into_kernel));
-
-        relation_futures.emplace_back(std::async(std::launch::async, incl_main_tag_err));
-
-        relation_futures.emplace_back(std::async(std::launch::async, incl_mem_tag_err));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_lo));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_mid));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_hi));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_pow_2_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_pow_2_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u8_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u8_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_2));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_3));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_4));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_5));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_6));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_7));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_8));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_9));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_10));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_11));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_12));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_13));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_14));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_2));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_3));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_4));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_5));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_6));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_7));
-
-        // Wait for lookup evaluations to complete
-        for (auto& future : relation_futures) {
-            int result = future.get();
-            if (!result) {
-                return false;
-            }
-        }
-#else
-
-        avm_alu();
-
-        avm_binary();
-
-        avm_conversion();
-
-        avm_main();
-
-        avm_mem();
-
-        perm_main_alu();
-
-        perm_main_bin();
-
-        perm_main_conv();
-
-        perm_main_mem_a();
-
-        perm_main_mem_b();
-
-        perm_main_mem_c();
-
-        perm_main_mem_d();
-
-        perm_main_mem_ind_a();
-
-        perm_main_mem_ind_b();
-
-        perm_main_mem_ind_c();
-
-        perm_main_mem_ind_d();
-
-        lookup_byte_lengths();
-
-        lookup_byte_operations();
-
-        lookup_into_kernel();
-
-        incl_main_tag_err();
-
-        incl_mem_tag_err();
-
-        lookup_mem_rng_chk_lo();
-
-        lookup_mem_rng_chk_mid();
-
-        lookup_mem_rng_chk_hi();
-
-        lookup_pow_2_0();
-
-        lookup_pow_2_1();
-
-        lookup_u8_0();
-
-        lookup_u8_1();
-
-        lookup_u16_0();
-
-        lookup_u16_1();
-
-        lookup_u16_2();
-
-        lookup_u16_3();
-
-        lookup_u16_4();
-
-        lookup_u16_5();
-
-        lookup_u16_6();
-
-        lookup_u16_7();
-
-        lookup_u16_8();
-
-        lookup_u16_9();
-
-        lookup_u16_10();
-
-        lookup_u16_11();
-
-        lookup_u16_12();
-
-        lookup_u16_13();
-
-        lookup_u16_14();
-
-        lookup_div_u16_0();
-
-        lookup_div_u16_1();
-
-        lookup_div_u16_2();
-
-        lookup_div_u16_3();
-
-        lookup_div_u16_4();
-
-        lookup_div_u16_5();
-
-        lookup_div_u16_6();
-
-        lookup_div_u16_7();
-
-#endif
-
-        return true;
+        TraceChecker<Flavor> checker(polys, num_rows, params, stop_at_first_failure);
+        checker.add_relation<Avm_vm::avm_alu<FF>>("avm_alu", Avm_vm::get_relation_label_avm_alu);
+        checker.add_relation<Avm_vm::avm_binary<FF>>("avm_binary", Avm_vm::get_relation_label_avm_binary);
+        checker.add_relation<Avm_vm::avm_conversion<FF>>(
+            "avm_conversion", Avm_vm::get_relation_label_avm_conversion);
+        checker.add_relation<Avm_vm::avm_main<FF>>("avm_main", Avm_vm::get_relation_label_avm_main);
+        checker.add_relation<Avm_vm::avm_mem<FF>>("avm_mem", Avm_vm::get_relation_label_avm_mem);
+        checker.add_lookup<perm_main_alu_relation<FF>>("PERM_MAIN_ALU");
+        checker.add_lookup<perm_main_bin_relation<FF>>("PERM_MAIN_BIN");
+        checker.add_lookup<perm_main_conv_relation<FF>>("PERM_MAIN_CONV");
+        checker.add_lookup<perm_main_mem_a_relation<FF>>("PERM_MAIN_MEM_A");
+        checker.add_lookup<perm_main_mem_b_relation<FF>>("PERM_MAIN_MEM_B");
+        checker.add_lookup<perm_main_mem_c_relation<FF>>("PERM_MAIN_MEM_C");
+        checker.add_lookup<perm_main_mem_d_relation<FF>>("PERM_MAIN_MEM_D");
+        checker.add_lookup<perm_main_mem_ind_a_relation<FF>>("PERM_MAIN_MEM_IND_A");
+        checker.add_lookup<perm_main_mem_ind_b_relation<FF>>("PERM_MAIN_MEM_IND_B");
+        checker.add_lookup<perm_main_mem_ind_c_relation<FF>>("PERM_MAIN_MEM_IND_C");
+        checker.add_lookup<perm_main_mem_ind_d_relation<FF>>("PERM_MAIN_MEM_IND_D");
+        checker.add_lookup<lookup_byte_lengths_relation<FF>>("LOOKUP_BYTE_LENGTHS");
+        checker.add_lookup<lookup_byte_operations_relation<FF>>("LOOKUP_BYTE_OPERATIONS");
+        checker.add_lookup<lookup_into_kernel_relation<FF>>("LOOKUP_INTO_KERNEL");
+        checker.add_lookup<incl_main_tag_err_relation<FF>>("INCL_MAIN_TAG_ERR");
+        checker.add_lookup<incl_mem_tag_err_relation<FF>>("INCL_MEM_TAG_ERR");
+        checker.add_lookup<lookup_mem_rng_chk_lo_relation<FF>>("LOOKUP_MEM_RNG_CHK_LO");
+        checker.add_lookup<lookup_mem_rng_chk_mid_relation<FF>>("LOOKUP_MEM_RNG_CHK_MID");
+        checker.add_lookup<lookup_mem_rng_chk_hi_relation<FF>>("LOOKUP_MEM_RNG_CHK_HI");
+        checker.add_lookup<lookup_pow_2_0_relation<FF>>("LOOKUP_POW_2_0");
+        checker.add_lookup<lookup_pow_2_1_relation<FF>>("LOOKUP_POW_2_1");
+        checker.add_lookup<lookup_u8_0_relation<FF>>("LOOKUP_U8_0");
+        checker.add_lookup<lookup_u8_1_relation<FF>>("LOOKUP_U8_1");
+        checker.add_lookup<lookup_u16_0_relation<FF>>("LOOKUP_U16_0");
+        checker.add_lookup<lookup_u16_1_relation<FF>>("LOOKUP_U16_1");
+        checker.add_lookup<lookup_u16_2_relation<FF>>("LOOKUP_U16_2");
+        checker.add_lookup<lookup_u16_3_relation<FF>>("LOOKUP_U16_3");
+        checker.add_lookup<lookup_u16_4_relation<FF>>("LOOKUP_U16_4");
+        checker.add_lookup<lookup_u16_5_relation<FF>>("LOOKUP_U16_5");
+        checker.add_lookup<lookup_u16_6_relation<FF>>("LOOKUP_U16_6");
+        checker.add_lookup<lookup_u16_7_relation<FF>>("LOOKUP_U16_7");
+        checker.add_lookup<lookup_u16_8_relation<FF>>("LOOKUP_U16_8");
+        checker.add_lookup<lookup_u16_9_relation<FF>>("LOOKUP_U16_9");
+        checker.add_lookup<lookup_u16_10_relation<FF>>("LOOKUP_U16_10");
+        checker.add_lookup<lookup_u16_11_relation<FF>>("LOOKUP_U16_11");
+        checker.add_lookup<lookup_u16_12_relation<FF>>("LOOKUP_U16_12");
+        checker.add_lookup<lookup_u16_13_relation<FF>>("LOOKUP_U16_13");
+        checker.add_lookup<lookup_u16_14_relation<FF>>("LOOKUP_U16_14");
+        checker.add_lookup<lookup_div_u16_0_relation<FF>>("LOOKUP_DIV_U16_0");
+        checker.add_lookup<lookup_div_u16_1_relation<FF>>("LOOKUP_DIV_U16_1");
+        checker.add_lookup<lookup_div_u16_2_relation<FF>>("LOOKUP_DIV_U16_2");
+        checker.add_lookup<lookup_div_u16_3_relation<FF>>("LOOKUP_DIV_U16_3");
+        checker.add_lookup<lookup_div_u16_4_relation<FF>>("LOOKUP_DIV_U16_4");
+        checker.add_lookup<lookup_div_u16_5_relation<FF>>("LOOKUP_DIV_U16_5");
+        checker.add_lookup<lookup_div_u16_6_relation<FF>>("LOOKUP_DIV_U16_6");
+        checker.add_lookup<lookup_div_u16_7_relation<FF>>("LOOKUP_DIV_U16_7");
+
+        return checker.run();
     }
 
     [[nodiscard]] size_t get_num_gates() const { return rows.size(); }
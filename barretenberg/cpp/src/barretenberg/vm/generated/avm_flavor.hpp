@@ -2176,6 +2176,7 @@ class AvmFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
     };
 
     using RowPolynomials = AllEntities<FF>;
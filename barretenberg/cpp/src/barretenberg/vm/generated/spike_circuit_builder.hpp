@@ -77,7 +77,7 @@ class SpikeCircuitBuilder {
             constexpr size_t NUM_SUBRELATIONS = result.size();
 
             for (size_t i = 0; i < num_rows; ++i) {
-                Relation::accumulate(result, polys.get_row(i), {}, 1);
+                Relation::accumulate(result, polys.get_row_view(i), {}, 1);
 
                 bool x = true;
                 for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
@@ -148,6 +148,7 @@ class SpikeFlavor {
             }
             return result;
         }
+        DEFINE_ROW_VIEW(AllEntities, FF)
     };
 
     using RowPolynomials = AllEntities<FF>;
@@ -219,6 +219,101 @@ TEST_F(AvmMemoryTests, readUninitializedMemoryViolation)
     EXPECT_THROW_WITH_MESSAGE(validate_trace_check_circuit(std::move(trace)), "MEM_ZERO_INIT");
 }
 
+// Testing that the report mode of the circuit checker returns all the violated relations at once,
+// whereas check_circuit only reports the first one.
+TEST_F(AvmMemoryTests, checkCircuitReportViolations)
+{
+    trace_builder.op_set(0, 4, 0, AvmMemoryTag::U8);
+    trace_builder.op_set(0, 9, 1, AvmMemoryTag::U8);
+
+    //                           Memory layout:      [4,9,0,0,0,0,....]
+    trace_builder.op_mul(0, 1, 0, 2, AvmMemoryTag::U8); // [4,9,36,0,0,0.....]
+    trace_builder.return_op(0, 2, 1);                   // Return single memory word at position 2 (36)
+    auto trace = trace_builder.finalize();
+
+    // Find the row with multiplication operation
+    auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_mul == FF(1); });
+
+    EXPECT_TRUE(row != trace.end());
+    auto clk = row->avm_main_clk + 1; // return operation is just after the multiplication
+
+    // Find the row for memory trace with last memory entry for address 2 (read for multiplication)
+    row = std::ranges::find_if(trace.begin(), trace.end(), [clk](Row r) {
+        return r.avm_mem_addr == FF(2) &&
+               r.avm_mem_tsp == FF(AvmMemTraceBuilder::NUM_SUB_CLK) * clk + AvmMemTraceBuilder::SUB_CLK_LOAD_A;
+    });
+
+    EXPECT_TRUE(row != trace.end());
+
+    row->avm_mem_val = FF(35);
+    row->avm_mem_tag = static_cast<uint32_t>(AvmMemoryTag::U16);
+
+    auto circuit_builder = AvmCircuitBuilder();
+    circuit_builder.set_trace(std::move(trace));
+    auto failures = circuit_builder.check_circuit_report();
+
+    auto has_failure = [&failures](const std::string& label) {
+        return std::ranges::any_of(failures, [&label](const auto& f) { return f.subrelation_label == label; });
+    };
+    EXPECT_TRUE(has_failure("MEM_READ_WRITE_VAL_CONSISTENCY"));
+    EXPECT_TRUE(has_failure("MEM_READ_WRITE_TAG_CONSISTENCY"));
+    EXPECT_TRUE(std::is_sorted(failures.begin(), failures.end()));
+
+    EXPECT_THROW_WITH_MESSAGE(circuit_builder.check_circuit(), failures.front().message());
+}
+
+// Testing that when a single row violates several subrelations of the same relation, both the report and
+// check_circuit name the subrelation with the lowest index first.
+TEST_F(AvmMemoryTests, checkCircuitReportOrdersSubrelationsOfOneRow)
+{
+    trace_builder.op_set(0, 4, 0, AvmMemoryTag::U8);
+    trace_builder.op_set(0, 9, 1, AvmMemoryTag::U8);
+
+    //                           Memory layout:      [4,9,0,0,0,0,....]
+    trace_builder.op_mul(0, 1, 0, 2, AvmMemoryTag::U8); // [4,9,36,0,0,0.....]
+    trace_builder.return_op(0, 2, 1);                   // Return single memory word at position 2 (36)
+    auto trace = trace_builder.finalize();
+
+    // Find the row with multiplication operation
+    auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_mul == FF(1); });
+
+    EXPECT_TRUE(row != trace.end());
+    auto clk = row->avm_main_clk + 1; // return operation is just after the multiplication
+
+    // Find the row for memory trace with last memory entry for address 2 (read for multiplication)
+    row = std::ranges::find_if(trace.begin(), trace.end(), [clk](Row r) {
+        return r.avm_mem_addr == FF(2) &&
+               r.avm_mem_tsp == FF(AvmMemTraceBuilder::NUM_SUB_CLK) * clk + AvmMemTraceBuilder::SUB_CLK_LOAD_A;
+    });
+
+    EXPECT_TRUE(row != trace.end());
+
+    // The read no longer matches the preceding write in both value and tag, so the preceding row violates the value
+    // and the tag consistency subrelations of avm_mem
+    row->avm_mem_val = FF(35);
+    row->avm_mem_tag = static_cast<uint32_t>(AvmMemoryTag::U16);
+
+    auto circuit_builder = AvmCircuitBuilder();
+    circuit_builder.set_trace(std::move(trace));
+    auto failures = circuit_builder.check_circuit_report();
+
+    auto find_failure = [&failures](const std::string& label) {
+        return std::ranges::find_if(failures, [&label](const auto& f) { return f.subrelation_label == label; });
+    };
+    auto val_failure = find_failure("MEM_READ_WRITE_VAL_CONSISTENCY");
+    auto tag_failure = find_failure("MEM_READ_WRITE_TAG_CONSISTENCY");
+    ASSERT_TRUE(val_failure != failures.end());
+    ASSERT_TRUE(tag_failure != failures.end());
+    EXPECT_EQ(val_failure->relation_index, tag_failure->relation_index);
+    EXPECT_EQ(val_failure->row, tag_failure->row);
+    EXPECT_LT(val_failure->subrelation_index, tag_failure->subrelation_index);
+    EXPECT_TRUE(*val_failure < *tag_failure);
+    EXPECT_LT(val_failure, tag_failure);
+
+    EXPECT_EQ(failures.front().subrelation_label, "MEM_READ_WRITE_VAL_CONSISTENCY");
+    EXPECT_THROW_WITH_MESSAGE(circuit_builder.check_circuit(), "MEM_READ_WRITE_VAL_CONSISTENCY");
+}
+
 // Testing violation that an operation with a mismatched memory tag
 // must raise a VM error.
 TEST_F(AvmMemoryTests, mismatchedTagErrorViolation)